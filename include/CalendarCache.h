@@ -0,0 +1,43 @@
+#ifndef CALENDAR_CACHE_H
+#define CALENDAR_CACHE_H
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Keeps the formatted local date ("Tue, 13 Oct 2020") together with the
+ * local day it belongs to, so checking it every minute is a comparison
+ * and the calendar is only broken down again once a day.
+ */
+class CalendarCache {
+public:
+    static const uint8_t maxDateLength = 23;
+
+    CalendarCache();
+
+    /**
+     * Reformats the date when now is outside the cached day, returns true
+     * when the text changed
+     */
+    bool update(time_t now);
+
+    const char *date() const { return text; }
+
+    /**
+     * Epoch of the next local midnight, when the date has to change
+     */
+    time_t nextMidnight() const { return dayEnd; }
+
+    /**
+     * How many times the date was rebuilt
+     */
+    uint32_t rebuildCount() const { return rebuilds; }
+
+private:
+    char text[maxDateLength + 1];
+    time_t dayStart;
+    time_t dayEnd;
+    uint32_t rebuilds;
+};
+
+#endif //CALENDAR_CACHE_H
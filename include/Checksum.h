@@ -0,0 +1,12 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * CRC-32 (IEEE 802.3) for validating records kept in Storage
+ */
+uint32_t crc32(const void *data, size_t size);
+
+#endif //CHECKSUM_H
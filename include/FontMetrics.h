@@ -0,0 +1,78 @@
+#ifndef FONT_METRICS_H
+#define FONT_METRICS_H
+
+#include <stddef.h>
+#include "hal/GfxFont.h"
+
+/**
+ * Compile-time text metrics over the constexpr GFXglyph table of a font,
+ * so fixed layouts get their widths and boxes as constants and can
+ * static_assert that they fit. Matches GlyphBlitter::glyphFor and
+ * fontExtent, which do the same work at run time from flash.
+ */
+class FontMetrics {
+public:
+    template<size_t N>
+    constexpr FontMetrics(const GFXglyph (&glyphs)[N], uint8_t first) : glyphs(glyphs), count(N), first(first) {}
+
+    constexpr bool contains(char c) const {
+        return (uint8_t) c >= first && (size_t) ((uint8_t) c - first) < count;
+    }
+
+    /**
+     * xAdvance of c, 0 when the font does not contain it
+     */
+    constexpr uint8_t advance(char c) const {
+        return contains(c) ? glyphs[(uint8_t) c - first].xAdvance : 0;
+    }
+
+    /**
+     * True when every character of text has a glyph that advances
+     */
+    constexpr bool provides(const char *text) const {
+        return *text == '\0' || (advance(*text) > 0 && provides(text + 1));
+    }
+
+    /**
+     * Sum of the advances of text
+     */
+    constexpr uint16_t width(const char *text) const {
+        return *text == '\0' ? 0 : advance(*text) + width(text + 1);
+    }
+
+    /**
+     * Top of the box covering every glyph, relative to the baseline
+     */
+    constexpr int16_t top() const { return topFrom(0, 0); }
+
+    /**
+     * Bottom of that box, relative to the baseline
+     */
+    constexpr int16_t bottom() const { return bottomFrom(0, 0); }
+
+    constexpr uint16_t height() const { return bottom() - top(); }
+
+    constexpr uint8_t maxAdvance() const { return maxAdvanceFrom(0, 0); }
+
+private:
+    //C++11 constexpr: loops over the table as tail recursion with the
+    //running result carried along
+    constexpr int16_t topFrom(size_t i, int16_t best) const {
+        return i == count ? best : topFrom(i + 1, glyphs[i].yOffset < best ? glyphs[i].yOffset : best);
+    }
+
+    constexpr int16_t bottomFrom(size_t i, int16_t best) const {
+        return i == count ? best : bottomFrom(i + 1, glyphs[i].yOffset + glyphs[i].height > best ?
+                                                     glyphs[i].yOffset + glyphs[i].height : best);
+    }
+
+    constexpr uint8_t maxAdvanceFrom(size_t i, uint8_t best) const {
+        return i == count ? best : maxAdvanceFrom(i + 1, glyphs[i].xAdvance > best ? glyphs[i].xAdvance : best);
+    }
+
+    const GFXglyph *glyphs;
+    size_t count;
+    uint8_t first;
+};
+
+#endif //FONT_METRICS_H
@@ -0,0 +1,95 @@
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Heap free number and text formatting into caller owned buffers.
+ *
+ * Every function writes at most size bytes including the terminating
+ * NUL, truncating rather than overflowing. Like snprintf they return the
+ * length the whole field needs, so a result >= size means it was cut.
+ * Fields are right aligned to width with the pad character.
+ */
+
+constexpr uint8_t digitCount(uint32_t value) {
+    return value < 10 ? 1 : 1 + digitCount(value / 10);
+}
+
+/**
+ * Characters a non-negative fixed-point value up to maxValue needs, point
+ * included, so layouts can static_assert that their fields fit
+ */
+constexpr uint8_t fieldChars(uint32_t maxValue, uint8_t decimals = 0) {
+    return (digitCount(maxValue) > decimals ? digitCount(maxValue) : decimals + 1) + (decimals > 0 ? 1 : 0);
+}
+
+size_t formatUnsigned(char *out, size_t size, uint32_t value, uint8_t width = 0, char pad = ' ');
+
+size_t formatInteger(char *out, size_t size, int32_t value, uint8_t width = 0);
+
+/**
+ * Writes a fixed-point value with the given number of decimals, e.g. 2250
+ * with 2 decimals is "22.50"
+ */
+size_t formatFixed(char *out, size_t size, int32_t value, uint8_t decimals, uint8_t width = 0);
+
+/**
+ * Zero padded field of exactly Width digits into a buffer known to hold
+ * it, for clock fields like "07"
+ */
+template<uint8_t Width, size_t N>
+size_t formatZeroPadded(char (&out)[N], uint32_t value) {
+    static_assert(N > Width, "buffer cannot hold the field");
+    return formatUnsigned(out, N, value, Width, '0');
+}
+
+/**
+ * Right aligned fixed-point field into a buffer known to hold Width
+ * characters, for the sensor tiles
+ */
+template<uint8_t Width, size_t N>
+size_t formatFixed(char (&out)[N], int32_t value, uint8_t decimals) {
+    static_assert(N > Width, "buffer cannot hold the field");
+    return formatFixed(out, N, value, decimals, Width);
+}
+
+/**
+ * Builds a line piece by piece in a fixed buffer, replacing snprintf for
+ * display text. Appends past the end are dropped and reported by
+ * truncated().
+ */
+class TextWriter {
+public:
+    TextWriter(char *buffer, size_t size);
+
+    template<size_t N>
+    explicit TextWriter(char (&buffer)[N]) : TextWriter(buffer, N) {}
+
+    TextWriter &text(const char *s);
+
+    TextWriter &character(char c);
+
+    TextWriter &integer(int32_t value, uint8_t width = 0);
+
+    TextWriter &zeroPadded(uint32_t value, uint8_t width);
+
+    TextWriter &fixed(int32_t value, uint8_t decimals, uint8_t width = 0);
+
+    const char *c_str() const { return out; }
+
+    size_t length() const { return used; }
+
+    bool truncated() const { return overflow; }
+
+private:
+    void advance(size_t wanted);
+
+    char *out;
+    size_t size;
+    size_t used;
+    bool overflow;
+};
+
+#endif //FORMAT_H
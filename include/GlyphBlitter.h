@@ -0,0 +1,97 @@
+#ifndef GLYPH_BLITTER_H
+#define GLYPH_BLITTER_H
+
+#include "hal/Display.h"
+#include "hal/GfxFont.h"
+#include "RleFont.h"
+
+/**
+ * Draws GFXfont glyphs as horizontal runs instead of single pixels.
+ *
+ * Every row of the 1bpp glyph bitmap is decoded into runs of set bits
+ * and each run becomes one writeFastHLine, all inside a single SPI
+ * transaction. The stock drawChar issues one writePixel per set bit.
+ *
+ * The opaque variants instead stream foreground and background of a
+ * whole glyph cell through one address window, so every pixel of the
+ * cell is written exactly once and no separate fillRect is needed. They
+ * also take run-length coded RleFonts, decoded row by row on the way.
+ */
+class GlyphBlitter {
+public:
+    static const uint8_t maxCellWidth = 128;
+
+    explicit GlyphBlitter(Display &display);
+
+    /**
+     * Returns the glyph for c or nullptr when the font does not contain it
+     */
+    static const GFXglyph *glyphFor(const GFXfont *font, char c);
+
+    static const GFXglyph *glyphFor(const RleFont *font, char c);
+
+    /**
+     * Returns the top (relative to the baseline) and height of the box
+     * covering every glyph of the font
+     */
+    static void fontExtent(const GFXfont *font, int16_t *top, uint16_t *height);
+
+    static void fontExtent(const RleFont *font, int16_t *top, uint16_t *height);
+
+    /**
+     * Draws c with its baseline origin at x, y and returns its xAdvance
+     */
+    int16_t drawChar(const GFXfont *font, int16_t x, int16_t y, char c, uint16_t color);
+
+    /**
+     * Draws text starting at x, y in one transaction and returns the end x
+     */
+    int16_t drawText(const GFXfont *font, int16_t x, int16_t y, const char *text, uint16_t color);
+
+    /**
+     * Paints the cell of c, xAdvance wide and height tall from top, with
+     * fg and bg in a single pass and returns its xAdvance
+     */
+    int16_t drawCharOpaque(const GFXfont *font, int16_t x, int16_t y, char c, uint16_t fg, uint16_t bg,
+                           int16_t top, uint16_t height);
+
+    int16_t drawCharOpaque(const RleFont *font, int16_t x, int16_t y, char c, uint16_t fg, uint16_t bg,
+                           int16_t top, uint16_t height);
+
+    /**
+     * Paints text opaquely and fills the rest of width with bg, so shorter
+     * text replaces longer text without clearing first. Returns the end x
+     */
+    int16_t drawTextOpaque(const GFXfont *font, int16_t x, int16_t y, const char *text, uint16_t fg, uint16_t bg,
+                           int16_t top, uint16_t height, uint16_t width);
+
+    /**
+     * Write calls issued since the last resetStats
+     */
+    uint32_t runCount() const { return runs; }
+
+    /**
+     * Pixels written since the last resetStats. For transparent draws this
+     * is also the number of writePixel calls the stock path would make
+     */
+    uint32_t pixelCount() const { return pixels; }
+
+    void resetStats();
+
+private:
+    void blitGlyph(const GFXfont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color);
+
+    void streamCell(const GFXfont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t fg, uint16_t bg,
+                    int16_t top, uint16_t height);
+
+    void streamCell(const RleFont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t fg, uint16_t bg,
+                    int16_t top, uint16_t height);
+
+    bool cellFits(int16_t x, int16_t cellY, uint8_t advance, uint16_t height) const;
+
+    Display &display;
+    uint32_t runs;
+    uint32_t pixels;
+};
+
+#endif //GLYPH_BLITTER_H
@@ -0,0 +1,33 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <stdint.h>
+
+/**
+ * Running minimum, average and maximum of a latency in microseconds
+ */
+class LatencyStats {
+public:
+    LatencyStats();
+
+    void add(uint32_t us);
+
+    uint32_t count() const { return samples; }
+
+    uint32_t last() const { return lastUs; }
+
+    uint32_t min() const { return samples > 0 ? minUs : 0; }
+
+    uint32_t max() const { return maxUs; }
+
+    uint32_t avg() const { return samples > 0 ? (uint32_t) (totalUs / samples) : 0; }
+
+private:
+    uint32_t samples;
+    uint32_t lastUs;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+};
+
+#endif //LATENCY_STATS_H
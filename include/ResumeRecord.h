@@ -0,0 +1,102 @@
+#ifndef RESUME_RECORD_H
+#define RESUME_RECORD_H
+
+#include <stdint.h>
+#include "hal/Clock.h"
+#include "hal/Storage.h"
+#include "CalendarCache.h"
+#include "SensorTile.h"
+
+/**
+ * What the clock knew before a reset, kept in RTC memory so a soft reset
+ * can show the time again before WiFi and NTP are back.
+ *
+ * save() stores the wall clock next to the RTC counter, together with
+ * the last sensor values and what was on screen; after the reset load()
+ * accepts the record only when its checksum matches and the counter has
+ * not restarted or wrapped since, and resumedEpochMs() is the saved time
+ * plus what the counter says has passed. RTC memory only survives while
+ * the board stays powered, and so does the panel's frame memory, so a
+ * valid record also means the screen still shows what it describes.
+ */
+class ResumeRecord {
+public:
+    static const time_t minValidEpoch = Clock::minValidEpoch;
+
+    /**
+     * A record this old is not trusted, the RTC counter drifts
+     */
+    static const uint32_t maxAgeMs = 3600000;
+
+    static const uint8_t tileCount = 3;
+
+    struct SensorState {
+        int32_t value;
+        int32_t previous;
+    };
+
+    struct TileState {
+        char value[SensorTile::maxValueLength + 1];
+        uint16_t bg;
+    };
+
+    /**
+     * Sensor values and screen contents, filled in by the caller
+     */
+    struct Snapshot {
+        SensorState temp;
+        SensorState humi;
+        SensorState lux;
+        char time[8];
+        char date[CalendarCache::maxDateLength + 1];
+        TileState tiles[tileCount];
+        bool screenValid;
+        bool syncMarkShown;
+    };
+
+    ResumeRecord(Storage &storage, Clock &clock);
+
+    /**
+     * Reads the record, true when it is intact and from this power cycle
+     */
+    bool load();
+
+    /**
+     * Snapshots the current wall clock and writes the record, does
+     * nothing while the clock is unset
+     */
+    bool save();
+
+    /**
+     * The saved wall clock moved forward by the time passed since
+     */
+    int64_t resumedEpochMs();
+
+    /**
+     * Milliseconds between the last save and load()
+     */
+    uint32_t ageMs() const { return age; }
+
+    Snapshot &snapshot() { return data.snapshot; }
+
+private:
+    struct Data {
+        uint32_t magic;
+        uint32_t rtcMillis;
+        int64_t epochMs;
+        Snapshot snapshot;
+        uint32_t crc;
+        uint32_t reserved;
+    };
+
+    static_assert(sizeof(Data) % 4 == 0, "RTC memory is written in 32 bit words");
+
+    static const uint32_t dataMagic = 0x434C4B32;
+
+    Storage &storage;
+    Clock &clock;
+    Data data;
+    uint32_t age;
+};
+
+#endif //RESUME_RECORD_H
@@ -0,0 +1,49 @@
+#ifndef RLE_FONT_H
+#define RLE_FONT_H
+
+#include "hal/GfxFont.h"
+
+/**
+ * A GFXfont whose glyph bitmaps are run-length coded by
+ * tools/fontsubset.py. The glyph table is the plain GFXglyph one, only
+ * bitmapOffset points into the run data instead of a 1bpp bitmap.
+ */
+typedef struct {
+    uint8_t *runs;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} RleFont;
+
+/**
+ * Decodes one run-length coded glyph a row at a time, straight from
+ * flash, so drawing needs a single row of state instead of the glyph.
+ *
+ * Runs alternate between clear and set pixels starting with clear and
+ * describe each row XORed with the one above it. A nibble of 0-14 is a
+ * run length, 15 is followed by two nibbles n for a run of 15 + n.
+ */
+class RleGlyphReader {
+public:
+    RleGlyphReader(const uint8_t *runs, uint8_t width);
+
+    /**
+     * Turns row, which holds the previous row (all clear before the first
+     * one) as width bits MSB first, into the next row of the glyph
+     */
+    void nextRow(uint8_t *row);
+
+private:
+    uint8_t nibble();
+
+    uint16_t runLength();
+
+    const uint8_t *data;
+    uint8_t width;
+    bool highNibble;
+    bool set;
+    uint16_t remaining;
+};
+
+#endif //RLE_FONT_H
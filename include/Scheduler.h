@@ -0,0 +1,76 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "hal/Clock.h"
+#include "hal/Console.h"
+
+/**
+ * Cooperative scheduler with a deadline per task.
+ *
+ * Each tick runs every task whose deadline has passed and then sleeps
+ * until the earliest remaining deadline, instead of polling at a fixed
+ * rate. Periodic tasks are re-armed from their previous deadline so
+ * they do not drift; a task can also move its own or another task's
+ * deadline, which is how minute-aligned and on-demand work is expressed.
+ */
+class Scheduler {
+public:
+    static const uint8_t maxTasks = 8;
+    static const uint32_t never = 0xFFFFFFFF;
+
+    typedef void (*TaskFunction)();
+
+    explicit Scheduler(Clock &clock);
+
+    /**
+     * Registers a task first due in firstDueMs and then every periodMs.
+     * A period of 0 runs it only when scheduled. Returns the task id or
+     * -1 when the table is full
+     */
+    int8_t add(const char *name, TaskFunction function, uint32_t firstDueMs, uint32_t periodMs);
+
+    /**
+     * Sets the next deadline of a task to inMs from now. An earlier
+     * pending deadline is kept unless replace is set
+     */
+    void schedule(int8_t task, uint32_t inMs, bool replace = false);
+
+    /**
+     * Runs the due tasks, then sleeps until the next deadline
+     */
+    void tick();
+
+    /**
+     * Milliseconds until the earliest deadline, never when nothing is armed
+     */
+    uint32_t untilNext();
+
+    uint32_t runs(int8_t task) const { return tasks[task].runs; }
+
+    uint32_t maxLatenessMs(int8_t task) const { return tasks[task].maxLateness; }
+
+    /**
+     * Prints run count and average/maximum lateness of every task
+     */
+    void report(Console &console) const;
+
+private:
+    struct Task {
+        const char *name;
+        TaskFunction function;
+        uint32_t periodMs;
+        uint32_t due;
+        bool armed;
+        uint32_t runs;
+        uint32_t totalLateness;
+        uint32_t maxLateness;
+    };
+
+    void runDue();
+
+    Clock &clock;
+    Task tasks[maxTasks];
+    uint8_t taskCount;
+};
+
+#endif //SCHEDULER_H
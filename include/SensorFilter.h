@@ -0,0 +1,60 @@
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include <stdint.h>
+
+/**
+ * Smooths a noisy sensor and decides when its value changed enough to
+ * be worth showing.
+ *
+ * Samples are fixed-point integers in whatever unit the sensor reports
+ * (0.01 °C, 0.1 lx, ...). They go through a median of the last
+ * medianWindow readings, which drops single spikes, then an exponential
+ * moving average with factor emaAlpha / 256 (256 disables it). The
+ * result is only published when it moves at least hysteresis away from
+ * the last published value.
+ */
+class SensorFilter {
+public:
+    static const uint8_t maxWindow = 7;
+    static const uint16_t alphaOne = 256;
+
+    SensorFilter(uint8_t medianWindow, uint16_t emaAlpha, int32_t hysteresis);
+
+    /**
+     * Feeds a sample, returns true when a new value was published
+     */
+    bool add(int32_t sample);
+
+    /**
+     * Last published value
+     */
+    int32_t value() const { return published; }
+
+    /**
+     * Current filter output, published or not
+     */
+    int32_t filtered() const { return ema; }
+
+    uint32_t sampleCount() const { return samples; }
+
+    uint32_t publishCount() const { return publishes; }
+
+private:
+    int32_t median() const;
+
+    uint8_t window;
+    uint16_t alpha;
+    int32_t hysteresis;
+
+    int32_t history[maxWindow];
+    uint8_t next;
+    uint8_t filled;
+
+    int32_t ema;
+    int32_t published;
+    uint32_t samples;
+    uint32_t publishes;
+};
+
+#endif //SENSOR_FILTER_H
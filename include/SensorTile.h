@@ -0,0 +1,67 @@
+#ifndef SENSOR_TILE_H
+#define SENSOR_TILE_H
+
+#include "TileCompositor.h"
+
+/**
+ * One labelled sensor tile that remembers what it last put on screen.
+ *
+ * show() compares the formatted value and tile colour with the last
+ * drawn ones and skips all display work when both are unchanged, so
+ * raw readings that round to the same text cost nothing.
+ */
+class SensorTile {
+public:
+    static const uint8_t maxValueLength = 8;
+
+    SensorTile(TileCompositor &compositor, const GFXfont *font, int16_t x, int16_t y, uint16_t w, uint16_t h,
+               const char *label);
+
+    /**
+     * Draws value on a bg coloured tile unless that is already shown.
+     * Returns true when the tile was drawn
+     */
+    bool show(const char *value, uint16_t bg);
+
+    /**
+     * Forgets what is on screen so the next show draws
+     */
+    void invalidate();
+
+    /**
+     * Takes value on bg as already on screen, for a panel that kept its
+     * contents over a reset
+     */
+    void assumeShown(const char *value, uint16_t bg);
+
+    /**
+     * The value and colour on screen, an empty value when nothing is
+     */
+    const char *shownText() const { return shown ? shownValue : ""; }
+
+    uint16_t shownColor() const { return shownBg; }
+
+    const char *label() const { return name; }
+
+    uint32_t drawnCount() const { return drawn; }
+
+    uint32_t skippedCount() const { return skipped; }
+
+private:
+    TileCompositor &compositor;
+    const GFXfont *font;
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+    const char *name;
+
+    char shownValue[maxValueLength + 1];
+    uint16_t shownBg;
+    bool shown;
+
+    uint32_t drawn;
+    uint32_t skipped;
+};
+
+#endif //SENSOR_TILE_H
@@ -0,0 +1,45 @@
+#ifndef TILE_COMPOSITOR_H
+#define TILE_COMPOSITOR_H
+
+#include "hal/Display.h"
+#include "hal/GfxFont.h"
+
+/**
+ * A piece of text placed inside a tile, x and baseline relative to the tile
+ */
+struct TileText {
+    const char *text;
+    const GFXfont *font;
+    int16_t x;
+    int16_t baseline;
+    uint16_t color;
+};
+
+/**
+ * Scanline compositor for the sensor tiles.
+ *
+ * Background, border and text spans are rasterized into one line buffer
+ * which is then pushed through a single address window covering the
+ * tile, so each tile pixel is written once per update. RAM cost is the
+ * line buffer, one panel row of RGB565.
+ */
+class TileCompositor {
+public:
+    static const uint16_t lineWidth = 320;
+
+    explicit TileCompositor(Display &display);
+
+    /**
+     * Composes and pushes a w x h tile at x, y with a one pixel border
+     */
+    void drawTile(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t bg, uint16_t border,
+                  const TileText *texts, uint8_t textCount);
+
+private:
+    void rasterizeText(const TileText &text, int16_t row, uint16_t w);
+
+    Display &display;
+    uint16_t line[lineWidth];
+};
+
+#endif //TILE_COMPOSITOR_H
@@ -0,0 +1,127 @@
+#ifndef TIME_RENDERER_H
+#define TIME_RENDERER_H
+
+#include "hal/Display.h"
+
+/**
+ * Size of a 14-segment character: digit width and height, stroke
+ * thickness and the space between characters. Every segment is derived
+ * from these, so the digits scale to any size.
+ */
+struct SegmentLayout {
+    uint8_t width;
+    uint8_t height;
+    uint8_t thickness;
+    uint8_t spacing;
+
+    constexpr uint8_t digitAdvance() const { return width + spacing; }
+
+    constexpr uint8_t colonAdvance() const { return thickness + spacing; }
+
+    constexpr uint8_t advance(char c) const { return c == ':' ? colonAdvance() : digitAdvance(); }
+
+    constexpr uint16_t textWidth(const char *text) const {
+        return *text == '\0' ? 0 : advance(*text) + textWidth(text + 1);
+    }
+
+    /**
+     * Room for three horizontal and two vertical strokes with gaps
+     */
+    constexpr bool valid() const { return thickness > 0 && width >= 4 * thickness && height >= 6 * thickness; }
+};
+
+/**
+ * Draws a short string of digits and ':' (HH:MM) as 14-segment
+ * characters built from filled rectangles instead of a bitmap font, and
+ * remembers which character is in every cell. An update only paints the
+ * segments that turned on in fg and the ones that turned off in the
+ * ghost colour, so a minute flip is a handful of rect fills. With a ghost
+ * colour other than bg the unlit segments stay faintly visible, like on
+ * a real LCD.
+ */
+class TimeRenderer {
+public:
+    static const uint8_t maxCells = 8;
+    static const uint8_t segmentCount = 15;
+
+    /**
+     * Draws with the bottom row of the digits on y, like a text baseline
+     */
+    TimeRenderer(Display &display, const SegmentLayout &layout, int16_t x, int16_t y, uint16_t fg, uint16_t bg,
+                 uint16_t ghost);
+
+    /**
+     * Draws text, painting only the segments that differ from the previous
+     * call. A cell that moved or changed between digit and colon is
+     * cleared and drawn again
+     */
+    void draw(const char *text);
+
+    /**
+     * Forgets what is on screen so the next draw repaints every cell
+     */
+    void invalidate();
+
+    /**
+     * Takes text as already on screen, so the next draw only paints the
+     * segments that differ from it
+     */
+    void assumeDrawn(const char *text);
+
+    /**
+     * Segments lit for c, bit n for segment n in the order a-f, g1, g2,
+     * h-m; h, j, k and m are the diagonals, i and l the centre verticals.
+     * Bit 14 are the two dots of ':'
+     */
+    static uint16_t segmentsFor(char c);
+
+    /**
+     * Every segment the cell of c has, lit or not
+     */
+    static uint16_t cellSegmentsFor(char c);
+
+    /**
+     * Pixels pushed to the display by the last draw call
+     */
+    uint32_t lastPixelsWritten() const { return lastPixels; }
+
+    /**
+     * Pixels pushed to the display since construction
+     */
+    uint32_t totalPixelsWritten() const { return totalPixels; }
+
+    /**
+     * Segments painted, on or off, by the last draw call
+     */
+    uint8_t lastSegmentsPainted() const { return lastSegments; }
+
+private:
+    uint32_t eraseCell(char c, int16_t cellX);
+
+    uint32_t drawCell(char c, int16_t cellX);
+
+    uint32_t paintSegments(uint16_t segments, int16_t cellX, uint16_t color);
+
+    uint32_t paintSegment(uint8_t segment, int16_t digitX, uint16_t color);
+
+    uint32_t paintDiagonal(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, bool falling, uint16_t color);
+
+    Display &display;
+    SegmentLayout layout;
+    int16_t x;
+    int16_t top;
+    uint16_t fg;
+    uint16_t bg;
+    uint16_t ghost;
+    uint8_t gap;
+
+    char drawnChars[maxCells];
+    int16_t drawnX[maxCells];
+    uint8_t drawnCount;
+
+    uint32_t lastPixels;
+    uint32_t totalPixels;
+    uint8_t lastSegments;
+};
+
+#endif //TIME_RENDERER_H
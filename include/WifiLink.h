@@ -0,0 +1,123 @@
+#ifndef WIFI_LINK_H
+#define WIFI_LINK_H
+
+#include "hal/Clock.h"
+#include "hal/Network.h"
+#include "hal/Storage.h"
+
+/**
+ * Keeps the WiFi connection up without ever blocking the loop.
+ *
+ * An attempt that does not connect within attemptTimeoutMs is dropped
+ * and retried after a backoff that doubles from minBackoffMs up to
+ * maxBackoffMs; once it reaches the cap the link counts as offline and
+ * keeps retrying at that rate. A lost connection starts over with an
+ * immediate attempt. Like the sensors it is driven by poll(), which
+ * says when it wants to be called again.
+ *
+ * Every DHCP connection's BSSID, channel and lease are kept in storage.
+ * Later attempts, also after a reboot, first associate with them
+ * directly, skipping the scan and DHCP; when that fails within
+ * fastTimeoutMs a scan follows at once. The hint survives such failures,
+ * an AP that is still booting is found on it again later, and is only
+ * replaced once a scan connects somewhere else. Past half the lease, when
+ * DHCP would renew it, the hint is not used and a link made through it is
+ * dropped for a DHCP one.
+ */
+class WifiLink {
+public:
+    enum State {
+        connecting, connected, backoff, offline
+    };
+
+    static const uint32_t attemptTimeoutMs = 15000;
+    static const uint32_t fastTimeoutMs = 3000;
+    static const uint32_t pollMs = 250;
+    static const uint32_t checkMs = 1000;
+    static const uint32_t minBackoffMs = 1000;
+    static const uint32_t maxBackoffMs = 300000;
+
+    WifiLink(Network &network, Clock &clock, Storage &storage);
+
+    /**
+     * Registers the access point, loads the stored hint and starts the
+     * first attempt
+     */
+    void begin(const char *ssid, const char *pass);
+
+    /**
+     * Advances the state machine. Returns true when the state has just
+     * changed, and sets nextMs to the delay before the next call
+     */
+    bool poll(uint32_t *nextMs);
+
+    State state() const { return current; }
+
+    static const char *stateName(State state);
+
+    /**
+     * millis() when the link first came up, 0 while it never did
+     */
+    uint32_t firstConnectedMs() const { return firstConnected; }
+
+    uint32_t attempts() const { return attemptCount; }
+
+    /**
+     * Times the link came up again after having been connected
+     */
+    uint32_t reconnects() const { return reconnectCount; }
+
+    /**
+     * Connections made through the stored hint without a scan
+     */
+    uint32_t fastConnects() const { return fastCount; }
+
+    /**
+     * How long the attempt that made the current connection took
+     */
+    uint32_t lastAttemptMs() const { return lastAttempt; }
+
+    /**
+     * Whether the latest attempt went straight to the stored AP
+     */
+    bool lastAttemptFast() const { return fastAttempt; }
+
+private:
+    struct Record {
+        uint32_t magic;
+        LinkHint hint;
+        uint32_t crc;
+    };
+
+    static const uint32_t recordMagic = 0x57494632;
+
+    void startAttempt(bool fast);
+
+    bool leaseUsable();
+
+    void updateLeaseExpiry();
+
+    void loadHint();
+
+    void storeHint();
+
+    Network &network;
+    Clock &clock;
+    Storage &storage;
+    LinkHint hint;
+    bool hintValid;
+    bool fastAttempt;
+    LinkHint leased;
+    bool expiryPending;
+    uint32_t leaseStart;
+    State current;
+    uint32_t since;
+    uint32_t backoffMs;
+    uint32_t firstConnected;
+    uint32_t attemptCount;
+    uint32_t reconnectCount;
+    uint32_t fastCount;
+    uint32_t lastAttempt;
+};
+
+#endif //WIFI_LINK_H
@@ -0,0 +1,67 @@
+#ifndef HAL_CLOCK_H
+#define HAL_CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Wall clock, monotonic counters and time synchronisation
+ */
+class Clock {
+public:
+    /**
+     * Earlier than this and the clock has never been set, 2020-01-01
+     */
+    static const time_t minValidEpoch = 1577836800;
+
+    virtual ~Clock() {}
+
+    /**
+     * Seconds since the epoch, as kept by the system clock
+     */
+    virtual time_t now() = 0;
+
+    /**
+     * Milliseconds since the epoch, for aligning work to wall clock boundaries
+     */
+    virtual int64_t epochMs() = 0;
+
+    virtual uint32_t millis() = 0;
+
+    virtual uint32_t micros() = 0;
+
+    /**
+     * Blocks for ms milliseconds while letting the system run
+     */
+    virtual void delay(uint32_t ms) = 0;
+
+    /**
+     * Milliseconds on a counter that keeps running across a soft reset
+     * and only restarts at power on, for carrying the time over a reset.
+     * It wraps after a few hours on the device, so only short spans
+     * measured on it are meaningful
+     */
+    virtual uint32_t rtcMillis() = 0;
+
+    /**
+     * Sets the wall clock, to restore a remembered time before NTP answers
+     */
+    virtual void setEpochMs(int64_t ms) = 0;
+
+    /**
+     * Sets the local timezone offsets without touching NTP
+     */
+    virtual void setTimezone(long gmtOffsetSec, int daylightOffsetSec) = 0;
+
+    /**
+     * Starts NTP synchronisation and sets the local timezone offsets
+     */
+    virtual void startSync(long gmtOffsetSec, int daylightOffsetSec, const char *server) = 0;
+
+    /**
+     * True once NTP has set the clock, a restored time does not count
+     */
+    virtual bool synced() = 0;
+};
+
+#endif //HAL_CLOCK_H
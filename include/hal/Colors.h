@@ -0,0 +1,18 @@
+#ifndef HAL_COLORS_H
+#define HAL_COLORS_H
+
+/**
+ * RGB565 colours used by the clock. The base ones match Adafruit_ILI9341
+ * so either header can be included first.
+ */
+#ifndef ILI9341_BLACK
+#define ILI9341_BLACK        0x0000
+#define ILI9341_WHITE        0xFFFF
+#define ILI9341_RED          0xF800
+#endif
+
+#define ILI9341_LORANGE      0xFC08
+#define ILI9341_LGREEN       0x87F0
+#define ILI9341_LCYAN        0x0418
+
+#endif //HAL_COLORS_H
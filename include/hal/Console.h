@@ -0,0 +1,16 @@
+#ifndef HAL_CONSOLE_H
+#define HAL_CONSOLE_H
+
+/**
+ * Diagnostic text output (Serial on the device, stdout natively)
+ */
+class Console {
+public:
+    virtual ~Console() {}
+
+    virtual void begin(unsigned long baud) = 0;
+
+    virtual void printf(const char *format, ...) __attribute__((format(printf, 2, 3))) = 0;
+};
+
+#endif //HAL_CONSOLE_H
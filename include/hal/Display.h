@@ -0,0 +1,50 @@
+#ifndef HAL_DISPLAY_H
+#define HAL_DISPLAY_H
+
+#include <stdint.h>
+
+/**
+ * The subset of an Adafruit_SPITFT panel the clock draws with.
+ *
+ * write* calls must be bracketed by startWrite/endWrite, the other
+ * drawing calls open their own transaction.
+ */
+class Display {
+public:
+    virtual ~Display() {}
+
+    virtual void begin() = 0;
+
+    virtual int16_t width() const = 0;
+
+    virtual int16_t height() const = 0;
+
+    virtual void startWrite() = 0;
+
+    virtual void endWrite() = 0;
+
+    virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+    virtual void writePixels(const uint16_t *colors, uint32_t len) = 0;
+
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
+
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) = 0;
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
+
+    virtual void fillScreen(uint16_t color) = 0;
+
+    /**
+     * Prints a line of boot screen text in the built-in font
+     */
+    virtual void println(const char *text, uint16_t color, uint8_t size = 1) = 0;
+
+    /**
+     * Attributes the drawing that follows to a named section, for displays
+     * that account their traffic. Ignored by real panels
+     */
+    virtual void profile(const char *section) { (void) section; }
+};
+
+#endif //HAL_DISPLAY_H
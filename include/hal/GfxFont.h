@@ -0,0 +1,42 @@
+#ifndef HAL_GFX_FONT_H
+#define HAL_GFX_FONT_H
+
+/**
+ * GFXfont tables and flash access for code that must also build off-device.
+ * On Arduino this is Adafruit GFX itself, natively the same structs and
+ * plain memory reads stand in.
+ */
+#ifdef ARDUINO
+
+#include <Adafruit_GFX.h>
+
+#else
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *) (addr))
+#define pgm_read_word(addr) (*(const uint16_t *) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t *) (addr))
+#define pgm_read_ptr(addr) (*(void *const *) (addr))
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+
+#endif
+
+#endif //HAL_GFX_FONT_H
@@ -0,0 +1,72 @@
+#ifndef HAL_NETWORK_H
+#define HAL_NETWORK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * What a successful association learned: the access point and channel,
+ * and the DHCP lease, so the next one can skip the scan and DHCP.
+ *
+ * leaseSeconds is the lease length DHCP granted. leaseExpiry is the
+ * epoch second the lease ends, 0 while unknown; the network leaves it to
+ * the caller, which knows when the lease was obtained
+ */
+struct LinkHint {
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t reserved;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t leaseSeconds;
+    uint32_t leaseExpiry;
+};
+
+/**
+ * WiFi station connectivity.
+ *
+ * Nothing here blocks: connect() only starts an association attempt and
+ * connected() reports how it is going, so the caller decides how long to
+ * wait and when to retry (see WifiLink).
+ */
+class Network {
+public:
+    virtual ~Network() {}
+
+    /**
+     * Registers the access point to join, without connecting
+     */
+    virtual void begin(const char *ssid, const char *pass) = 0;
+
+    /**
+     * Starts associating with the access point and returns immediately.
+     * With a hint it goes straight to that BSSID and channel and reuses
+     * the lease as a static IP, without one it scans and asks DHCP
+     */
+    virtual void connect(const LinkHint *hint) = 0;
+
+    /**
+     * Drops the link or abandons a pending attempt
+     */
+    virtual void disconnect() = 0;
+
+    /**
+     * True once associated with an IP
+     */
+    virtual bool connected() = 0;
+
+    /**
+     * Describes the current link, false while not connected. The lease
+     * is only meaningful after connecting without a hint, through DHCP
+     */
+    virtual bool linkHint(LinkHint *hint) = 0;
+
+    /**
+     * Writes the dotted local IP address into buffer
+     */
+    virtual void localIP(char *buffer, size_t size) = 0;
+};
+
+#endif //HAL_NETWORK_H
@@ -0,0 +1,36 @@
+#ifndef HAL_PLATFORM_H
+#define HAL_PLATFORM_H
+
+#include "hal/Clock.h"
+#include "hal/Console.h"
+#include "hal/Display.h"
+#include "hal/Network.h"
+#include "hal/Sensors.h"
+#include "hal/Storage.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+/**
+ * Lets background work run during long operations, a no-op natively
+ */
+void yield();
+#endif
+
+/**
+ * The hardware the clock runs on, one implementation per PlatformIO env
+ */
+struct Platform {
+    Display &display;
+    ClimateSensor &climate;
+    LightSensor &light;
+    Clock &clock;
+    Network &network;
+    Storage &flash;
+    Storage &rtc;
+    Console &console;
+};
+
+Platform &platform();
+
+#endif //HAL_PLATFORM_H
@@ -0,0 +1,84 @@
+#ifndef HAL_SENSORS_H
+#define HAL_SENSORS_H
+
+#include <stdint.h>
+
+/**
+ * Static description of a sensor, as shown on the boot screen.
+ * Only used at boot, so it keeps plain floating point units.
+ */
+struct SensorInfo {
+    char name[12];
+    int32_t version;
+    int32_t sensorId;
+    float maxValue;
+    float minValue;
+    float resolution;
+    int32_t minDelayUs;
+};
+
+/**
+ * Temperature and relative humidity sensor (DHT11 on the device).
+ *
+ * Measuring is asynchronous: poll() advances the current transaction
+ * and tells when it wants to be called again, the read functions return
+ * the values of the last completed transaction.
+ */
+class ClimateSensor {
+public:
+    virtual ~ClimateSensor() {}
+
+    virtual void begin() = 0;
+
+    virtual void temperatureInfo(SensorInfo *info) = 0;
+
+    virtual void humidityInfo(SensorInfo *info) = 0;
+
+    /**
+     * Advances the measurement. Returns true when a transaction has just
+     * completed, and sets nextMs to the delay before the next call
+     */
+    virtual bool poll(uint32_t *nextMs) = 0;
+
+    /**
+     * Temperature in 0.01 °C of the last transaction, false if it failed
+     */
+    virtual bool readTemperature(int32_t *centiCelsius) = 0;
+
+    /**
+     * Relative humidity in 0.01 % of the last transaction, false if it failed
+     */
+    virtual bool readHumidity(int32_t *centiPercent) = 0;
+};
+
+/**
+ * Ambient light sensor (BH1750 on the device).
+ *
+ * Asynchronous like ClimateSensor: the first poll() starts a measurement,
+ * the one after the integration time collects it.
+ */
+class LightSensor {
+public:
+    /**
+     * Brightest reading in 0.1 lx: the BH1750 saturating at 65535 counts
+     * in its least sensitive range, MTreg 31 (about 121.6 klx)
+     */
+    static const int32_t maxDeciLux = 1215577;
+
+    virtual ~LightSensor() {}
+
+    virtual void begin() = 0;
+
+    /**
+     * Starts or collects a measurement. Returns true when one has just
+     * completed; otherwise sets nextMs to the time until it completes
+     */
+    virtual bool poll(uint32_t *nextMs) = 0;
+
+    /**
+     * Illuminance in 0.1 lx of the last measurement, false if it failed
+     */
+    virtual bool readLux(int32_t *deciLux) = 0;
+};
+
+#endif //HAL_SENSORS_H
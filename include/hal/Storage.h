@@ -0,0 +1,27 @@
+#ifndef HAL_STORAGE_H
+#define HAL_STORAGE_H
+
+#include <stddef.h>
+
+/**
+ * A small block of memory that survives a restart. It holds one record,
+ * which the caller checksums: a read of a never written or corrupted
+ * block returns whatever bytes are there.
+ */
+class Storage {
+public:
+    virtual ~Storage() {}
+
+    /**
+     * Reads size bytes from the start, false when the block is smaller
+     * or cannot be read
+     */
+    virtual bool read(void *data, size_t size) = 0;
+
+    /**
+     * Writes size bytes at the start, false when it did not make it
+     */
+    virtual bool write(const void *data, size_t size) = 0;
+};
+
+#endif //HAL_STORAGE_H
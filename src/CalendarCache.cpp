@@ -0,0 +1,69 @@
+#include <string.h>
+#include "CalendarCache.h"
+#include "Format.h"
+
+/**
+ * Indexed by tm_wday and tm_mon as localtime fills them
+ */
+static constexpr char weekDays[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static constexpr char months[12][4] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                       "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+static constexpr uint8_t monthOffsets[12] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+
+/**
+ * Day of the week of a Gregorian date, 0 for Sunday like tm_wday
+ * (Sakamoto's method: January and February count as months of the
+ * previous year)
+ */
+static constexpr int dayOfWeek(int year, int month, int day) {
+    return ((month < 3 ? year - 1 : year) + (month < 3 ? year - 1 : year) / 4 - (month < 3 ? year - 1 : year) / 100 +
+            (month < 3 ? year - 1 : year) / 400 + monthOffsets[month - 1] + day) % 7;
+}
+
+static constexpr bool sameName(const char *a, const char *b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static constexpr bool isDay(int year, int month, int day, const char *name) {
+    return sameName(weekDays[dayOfWeek(year, month, day)], name);
+}
+
+static_assert(isDay(1970, 1, 1, "Thu"), "weekday table out of order");
+static_assert(isDay(2020, 10, 13, "Tue"), "weekday table out of order");
+static_assert(isDay(2020, 2, 29, "Sat"), "weekday table out of order");
+static_assert(isDay(2024, 12, 31, "Tue"), "weekday table out of order");
+static_assert(CalendarCache::maxDateLength + 1 >= sizeof("Wed, 31 Sep 2020"), "date buffer too small");
+
+CalendarCache::CalendarCache() : text(), dayStart(1), dayEnd(0), rebuilds(0) {
+}
+
+/**
+ * Epoch of local midnight dayOffset days from the day in local
+ */
+static time_t localMidnight(const struct tm &local, int dayOffset) {
+    struct tm midnight = local;
+    midnight.tm_mday += dayOffset;
+    midnight.tm_hour = 0;
+    midnight.tm_min = 0;
+    midnight.tm_sec = 0;
+    //Let mktime work out whether DST is in effect that day
+    midnight.tm_isdst = -1;
+    return mktime(&midnight);
+}
+
+bool CalendarCache::update(time_t now) {
+    if (now >= dayStart && now < dayEnd) {
+        return false;
+    }
+    struct tm local = *localtime(&now);
+    dayStart = localMidnight(local, 0);
+    dayEnd = localMidnight(local, 1);
+    rebuilds++;
+
+    char previous[maxDateLength + 1];
+    strcpy(previous, text);
+    TextWriter(text).text(weekDays[local.tm_wday]).text(", ").integer(local.tm_mday).character(' ')
+            .text(months[local.tm_mon]).character(' ').integer(local.tm_year + 1900);
+    return strcmp(previous, text) != 0;
+}
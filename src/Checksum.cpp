@@ -0,0 +1,14 @@
+#include "Checksum.h"
+
+uint32_t crc32(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+        //Bitwise rather than a 1 KB table, records are a few dozen bytes
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
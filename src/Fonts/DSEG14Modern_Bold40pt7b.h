@@ -2732,7 +2732,7 @@ const uint8_t DSEG14Modern_Bold40pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x4F,
   0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
 
-const GFXglyph DSEG14Modern_Bold40pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph DSEG14Modern_Bold40pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,  16,    0,    0 },   // 0x20 ' '
   {     1,   1,   1,  64,    0,    0 },   // 0x21 '!'
   {     2,  29,  37,  64,    8,  -73 },   // 0x22 '"'
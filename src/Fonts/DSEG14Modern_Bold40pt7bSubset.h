@@ -0,0 +1,389 @@
+/**
+ * DSEG14 by Keshikan(Twitter:@keshinomi_88pro)
+ * https://fontlibrary.org/en/font/dseg14
+ */
+
+//Generated by tools/fontsubset.py from DSEG14Modern_Bold40pt7b.h, do not edit.
+//Keeps 0123456789:
+
+const uint8_t DSEG14Modern_Bold40pt7bSubsetBitmaps[] PROGMEM = {
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
+  0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x39, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7B, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x01, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x03, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x03, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x07, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x07, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF3, 0xFF,
+  0xFF, 0x80, 0x00, 0x1F, 0xE3, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xE3, 0xFF,
+  0xFF, 0x80, 0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC3, 0xFF,
+  0xFF, 0x80, 0x00, 0x3F, 0x81, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0xFF,
+  0xFF, 0x80, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x30, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x60, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7E,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x04, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x1C, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x03, 0xFF,
+  0xFE, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x81, 0xF8, 0x00, 0x03, 0xFF,
+  0xFF, 0x83, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x03, 0xFF,
+  0xFF, 0x87, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x8F, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0x8F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xE0, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xE0, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0x80, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x9F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x9E, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x9C, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFE, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+  0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+  0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x01, 0x00, 0x60, 0x3C, 0x0F, 0x07, 0xC1, 0xF0, 0xFC, 0x7F, 0x1F, 0xCF,
+  0xF3, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xCF, 0xF0, 0xFC, 0x0F, 0x01, 0xC3, 0x11,
+  0xF0, 0x7E, 0x3F, 0xCF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7F, 0xCF, 0xF0, 0xFC, 0x0F, 0x01, 0xC0, 0x10, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x9F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1C, 0x00,
+  0x00, 0x7E, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x8F, 0x00, 0x3F, 0xC0,
+  0x03, 0xFF, 0x87, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x01, 0x00, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF0,
+  0x0F, 0xFC, 0x00, 0xC1, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0xF1, 0xFF, 0x00,
+  0x01, 0xF8, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0x78, 0x00, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0xFF,
+  0xFF, 0xE0, 0x00, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x9F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1C, 0x00,
+  0x00, 0x7E, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x8F, 0x00, 0x3F, 0xC0,
+  0x03, 0xFF, 0x87, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x31, 0x00, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x00, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0x01, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9C, 0x00,
+  0x00, 0x7E, 0x3F, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0x87, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0x31, 0xFE, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x3C, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x0C, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0x01, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x00, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00,
+  0x00, 0x7E, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0x80, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0x30, 0xFE, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x3C, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x0C, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0x01, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x00, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00,
+  0x00, 0x7E, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0x80, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0x30, 0xFE, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x3C, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x0C, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0xC1, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0xF1, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0xFC, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF3, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0C, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9C, 0x00,
+  0x00, 0x7E, 0x3F, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0x87, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0x31, 0xFE, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x3C, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x0C, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0xC1, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0xF1, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0xFC, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF3, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xCF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x9F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x1F, 0xFF,
+  0xFF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9C, 0x00,
+  0x00, 0x7E, 0x3F, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x3F, 0xC0,
+  0x03, 0xFF, 0x87, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0x31, 0xFE, 0x7F, 0xF8,
+  0x3F, 0xFF, 0x7C, 0x3C, 0xFF, 0xF8, 0x3F, 0xFE, 0x7E, 0x0C, 0xFF, 0xF0,
+  0x0F, 0xFC, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0xFF, 0x01, 0xFF, 0x00,
+  0x01, 0xF9, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFF, 0xE1, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E, 0x1F, 0xC7,
+  0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xFE, 0x7F, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0x0F, 0xC7, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xFE, 0x7F,
+  0x07, 0x80 };
+
+constexpr GFXglyph DSEG14Modern_Bold40pt7bSubsetGlyphs[] PROGMEM = {
+  {     0,  48,  78,  64,    8,  -77 },   // 0x30 '0'
+  {   468,  10,  74,  64,   46,  -77 },   // 0x31 '1'
+  {   561,  48,  78,  64,    8,  -77 },   // 0x32 '2'
+  {  1029,  48,  78,  64,    8,  -77 },   // 0x33 '3'
+  {  1497,  48,  74,  64,    8,  -77 },   // 0x34 '4'
+  {  1941,  48,  78,  64,    8,  -77 },   // 0x35 '5'
+  {  2409,  48,  78,  64,    8,  -77 },   // 0x36 '6'
+  {  2877,  48,  74,  64,    8,  -77 },   // 0x37 '7'
+  {  3321,  48,  78,  64,    8,  -77 },   // 0x38 '8'
+  {  3789,  48,  78,  64,    8,  -77 },   // 0x39 '9'
+  {  4257,  10,  42,  16,    3,  -58 } }; // 0x3A ':'
+
+const GFXfont DSEG14Modern_Bold40pt7bSubset PROGMEM = {
+  (uint8_t  *)DSEG14Modern_Bold40pt7bSubsetBitmaps,
+  (GFXglyph *)DSEG14Modern_Bold40pt7bSubsetGlyphs,
+  0x30, 0x3A, 85 };
+
+// Approx. 4394 bytes
@@ -0,0 +1,146 @@
+/**
+ * DSEG14 by Keshikan(Twitter:@keshinomi_88pro)
+ * https://fontlibrary.org/en/font/dseg14
+ */
+
+//Generated by tools/fontsubset.py from DSEG14Modern_Bold40pt7b.h, do not edit.
+//Keeps 0123456789:
+//Run-length coded, include RleFont.h first
+
+const uint8_t DSEG14Modern_Bold40pt7bSubsetRleRuns[] PROGMEM = {
+  0x1F, 0x1C, 0x11, 0x21, 0xF1, 0xB1, 0x21, 0xF1, 0xC1, 0x11, 0x23, 0xF2,
+  0x12, 0xF1, 0x61, 0x11, 0x42, 0x21, 0xF1, 0xE2, 0x12, 0xF1, 0x21, 0x11,
+  0x92, 0x12, 0xF1, 0x11, 0xC1, 0x22, 0xF0, 0xD1, 0xF0, 0x02, 0x21, 0xF0,
+  0xB1, 0x11, 0xF0, 0x4F, 0x0B, 0xF1, 0xD3, 0x21, 0xF1, 0xF1, 0xF1, 0xB1,
+  0xF1, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF7, 0xF1, 0xFA, 0xF1, 0xF5, 0x81,
+  0xF1, 0x71, 0x71, 0xF4, 0xF1, 0xF4, 0x81, 0x61, 0x41, 0xF1, 0xA1, 0x61,
+  0xF1, 0x72, 0x82, 0xF1, 0x32, 0xC2, 0xC1, 0xF0, 0x11, 0x11, 0xF0, 0x11,
+  0xA1, 0xF0, 0x22, 0xF0, 0x02, 0x12, 0xF1, 0xB1, 0x22, 0x13, 0x41, 0xF1,
+  0x81, 0x32, 0xF1, 0x51, 0x63, 0x22, 0xF0, 0x01, 0xF0, 0xD2, 0xF0, 0x02,
+  0xF0, 0x31, 0xC2, 0xC1, 0xF0, 0x41, 0xF0, 0x01, 0x92, 0xF1, 0x62, 0x61,
+  0x51, 0xF1, 0x91, 0xF1, 0xF1, 0xF2, 0x71, 0xF1, 0x81, 0xF4, 0xF1, 0xF2,
+  0x81, 0xFA, 0xF1, 0xF7, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4,
+  0xA1, 0x23, 0xF1, 0xA1, 0x1F, 0x0B, 0x31, 0xF1, 0xD2, 0x21, 0xE1, 0x11,
+  0xF0, 0xD2, 0x12, 0xF1, 0xE2, 0x12, 0x91, 0x11, 0xF1, 0x21, 0x21, 0x91,
+  0xF1, 0x42, 0x12, 0x51, 0xF1, 0x82, 0x11, 0x31, 0x11, 0xF1, 0x91, 0xF2,
+  0x21, 0x11, 0x11, 0xF1, 0xC0, 0x71, 0xA1, 0x71, 0x21, 0xF0, 0x01, 0xF0,
+  0x31, 0x81, 0xF0, 0x31, 0xF0, 0x31, 0x81, 0xFB, 0x81, 0xA1, 0xA2, 0xA2,
+  0xA1, 0x72, 0x12, 0x41, 0x22, 0x11, 0x81, 0x31, 0x61, 0xB1, 0x81, 0xFE,
+  0xA1, 0xA1, 0xA2, 0xA2, 0xA1, 0xA2, 0x10, 0x1F, 0x1C, 0x11, 0x21, 0xF1,
+  0xB1, 0x21, 0xF1, 0xC1, 0x11, 0x23, 0xF2, 0x12, 0xF1, 0x61, 0x11, 0x81,
+  0xF2, 0x12, 0xF1, 0x21, 0x11, 0xC2, 0xF1, 0x11, 0xF0, 0x02, 0xF0, 0xD1,
+  0xF0, 0x41, 0xF0, 0xB1, 0x11, 0xF0, 0x4F, 0x0B, 0xF2, 0x21, 0xF1, 0xF1,
+  0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x61, 0xF2, 0x11, 0xF0, 0x43,
+  0xF0, 0x46, 0x12, 0xF0, 0x11, 0x32, 0xF0, 0x02, 0x62, 0x12, 0xF0, 0x52,
+  0xC1, 0xD1, 0xC1, 0x82, 0x82, 0xA1, 0x42, 0xF0, 0x61, 0x52, 0xF0, 0x41,
+  0x81, 0xF0, 0xF1, 0xF0, 0xD1, 0x52, 0xA1, 0x92, 0x51, 0xA2, 0x82, 0xF0,
+  0x52, 0xC2, 0xC1, 0x61, 0xE2, 0x12, 0x52, 0xF0, 0x02, 0xF0, 0x61, 0x25,
+  0xF0, 0x44, 0xF0, 0x32, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFE, 0x61,
+  0xF1, 0xF1, 0x1F, 0x0B, 0xF2, 0x12, 0xF0, 0x21, 0x11, 0xF0, 0xD2, 0xF2,
+  0x12, 0xC1, 0x11, 0xF1, 0x21, 0xC1, 0xF1, 0x42, 0x81, 0xF1, 0x82, 0x51,
+  0x11, 0xF1, 0x91, 0xF2, 0x21, 0x11, 0x11, 0xF1, 0xC0, 0x1F, 0x1C, 0x11,
+  0x21, 0xF1, 0xB1, 0x21, 0xF1, 0xC1, 0x11, 0x23, 0xF2, 0x12, 0xF1, 0x61,
+  0x11, 0x81, 0xF2, 0x12, 0xF1, 0x21, 0x11, 0xC2, 0xF1, 0x11, 0xF0, 0x02,
+  0xF0, 0xD1, 0xF0, 0x41, 0xF0, 0xB1, 0x11, 0xF0, 0x4F, 0x0B, 0xF2, 0x21,
+  0xF1, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x61, 0xF2, 0x11,
+  0xF0, 0x43, 0xF0, 0x46, 0x12, 0xF0, 0x11, 0x32, 0xF0, 0x02, 0x62, 0x12,
+  0xF0, 0x52, 0xC1, 0xD1, 0xC1, 0x82, 0x82, 0xA1, 0x12, 0x12, 0xF0, 0x61,
+  0x52, 0xD1, 0x22, 0x11, 0x81, 0xF0, 0xF1, 0x61, 0xF0, 0x61, 0x52, 0xA1,
+  0x11, 0x61, 0x71, 0xA2, 0x82, 0xF1, 0x32, 0xC1, 0x61, 0x11, 0xF0, 0x02,
+  0x52, 0xF0, 0x02, 0x51, 0xF0, 0x35, 0xF0, 0x44, 0xFF, 0xF0, 0xFF, 0xF0,
+  0xFF, 0xF0, 0xFF, 0xF0, 0xF1, 0xDF, 0x0B, 0x31, 0xF1, 0xD2, 0x21, 0xF0,
+  0x11, 0xF0, 0xD2, 0x12, 0xF1, 0xE2, 0x12, 0xB1, 0xF1, 0x21, 0x21, 0x91,
+  0xF1, 0x42, 0x12, 0xF1, 0xE2, 0x11, 0x51, 0xF1, 0x91, 0xF2, 0x61, 0xF1,
+  0xC0, 0xF1, 0xE1, 0xF2, 0x11, 0xF1, 0xE1, 0x21, 0xF4, 0xC1, 0x42, 0xF2,
+  0x12, 0xF1, 0x71, 0x92, 0xF1, 0x41, 0xC1, 0xF2, 0x12, 0xF1, 0x01, 0xF4,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x61, 0xF2,
+  0x11, 0xF0, 0x43, 0xF0, 0x46, 0x12, 0xF0, 0x11, 0x32, 0xF0, 0x02, 0x62,
+  0x12, 0xC1, 0x72, 0xC1, 0xD1, 0xA1, 0x11, 0x82, 0x82, 0xA1, 0x12, 0x12,
+  0xF0, 0x61, 0x52, 0xD1, 0x22, 0x13, 0x41, 0x11, 0xF0, 0xF1, 0x61, 0x32,
+  0xF0, 0x11, 0x52, 0xA1, 0x11, 0x61, 0x42, 0x11, 0xA2, 0x82, 0xF1, 0x32,
+  0xC1, 0x61, 0x11, 0xF0, 0x02, 0x52, 0xF0, 0x02, 0x51, 0xF0, 0x35, 0xF0,
+  0x44, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF3, 0xA1, 0xF2,
+  0x11, 0xF2, 0x12, 0xF2, 0x12, 0xF2, 0x11, 0xF2, 0x12, 0x10, 0x1F, 0x1C,
+  0x41, 0xF1, 0xB1, 0xF1, 0xF1, 0x52, 0xF2, 0x12, 0xF1, 0x61, 0x62, 0x21,
+  0xF1, 0xE2, 0x12, 0xF1, 0x21, 0xB2, 0x12, 0xF1, 0xE1, 0x22, 0xF0, 0xD1,
+  0xF0, 0x02, 0x21, 0xF0, 0xB1, 0xF0, 0x6F, 0x0B, 0xFF, 0xF0, 0xFF, 0xF0,
+  0xFF, 0xF0, 0xFF, 0xF0, 0xF1, 0xE3, 0xF0, 0x46, 0xF0, 0x41, 0x32, 0xF0,
+  0x02, 0x62, 0xF0, 0x01, 0x72, 0xC1, 0xF0, 0x91, 0x11, 0x82, 0x82, 0xA1,
+  0x12, 0xF0, 0x91, 0x52, 0xD1, 0x22, 0x22, 0x41, 0x11, 0xF0, 0xF1, 0x61,
+  0x32, 0xF0, 0x11, 0x52, 0xA1, 0x11, 0x61, 0x42, 0x11, 0xA2, 0x82, 0xF1,
+  0x32, 0xC1, 0x61, 0x11, 0xF0, 0x02, 0x52, 0xF0, 0x02, 0x51, 0xF0, 0x35,
+  0xF0, 0x44, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF1, 0xDF,
+  0x0B, 0x31, 0xF1, 0xD2, 0x21, 0xF0, 0x11, 0xF0, 0xD2, 0x12, 0xF1, 0xE2,
+  0x12, 0xB1, 0xF1, 0x21, 0x21, 0x91, 0xF1, 0x42, 0x12, 0xF1, 0xE2, 0x11,
+  0x51, 0xF1, 0x91, 0xF2, 0x61, 0xF1, 0xC0, 0x1F, 0x1C, 0x41, 0xF1, 0xB1,
+  0xF1, 0xF1, 0x52, 0xF2, 0x12, 0xF1, 0x61, 0x62, 0x21, 0xF1, 0xE2, 0x12,
+  0xF1, 0x21, 0xB2, 0x12, 0xF1, 0xE1, 0x22, 0xF0, 0xD1, 0xF0, 0x02, 0x21,
+  0xF0, 0xB1, 0xF0, 0x6F, 0x0B, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+  0xF0, 0xF1, 0xE3, 0xF0, 0x46, 0xF0, 0x41, 0x32, 0xF0, 0x02, 0x62, 0xF0,
+  0x01, 0x72, 0xC1, 0xF0, 0x91, 0x11, 0x82, 0x82, 0xA1, 0x12, 0xF0, 0x91,
+  0x52, 0xD1, 0x22, 0x22, 0x41, 0x11, 0xF0, 0xF1, 0x61, 0x32, 0xF0, 0x11,
+  0x52, 0xA1, 0x11, 0x63, 0x22, 0x11, 0xA2, 0x82, 0xF0, 0x52, 0xC2, 0xC1,
+  0x61, 0x11, 0xC2, 0x12, 0x52, 0xF0, 0x02, 0x51, 0xF0, 0x01, 0x25, 0xF0,
+  0x44, 0xF0, 0x32, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFE, 0x61, 0xF1,
+  0xF1, 0x1F, 0x0B, 0x31, 0xF1, 0xD2, 0x21, 0xE1, 0x11, 0xF0, 0xD2, 0x12,
+  0xF1, 0xE2, 0x12, 0x91, 0x11, 0xF1, 0x21, 0x21, 0x91, 0xF1, 0x42, 0x12,
+  0x51, 0xF1, 0x82, 0x11, 0x31, 0x11, 0xF1, 0x91, 0xF2, 0x21, 0x11, 0x11,
+  0xF1, 0xC0, 0x1F, 0x1C, 0x11, 0x21, 0xF1, 0xB1, 0x21, 0xF1, 0xC1, 0x11,
+  0x23, 0xF2, 0x12, 0xF1, 0x61, 0x11, 0x42, 0x21, 0xF1, 0xE2, 0x12, 0xF1,
+  0x21, 0x11, 0x92, 0x12, 0xF1, 0x11, 0xC1, 0x22, 0xF0, 0xD1, 0xF0, 0x02,
+  0x21, 0xF0, 0xB1, 0x11, 0xF0, 0x4F, 0x0B, 0xF2, 0x21, 0xF1, 0xF1, 0xFF,
+  0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x61, 0xF2, 0x11, 0xF2, 0x12, 0xF2,
+  0x12, 0xC1, 0xF1, 0x41, 0xA1, 0xF1, 0x32, 0x12, 0xF1, 0xB1, 0x22, 0x13,
+  0x41, 0xF1, 0x81, 0x32, 0xF1, 0x51, 0x61, 0x42, 0xF4, 0x21, 0xF1, 0xF1,
+  0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF6, 0x81, 0xF2, 0x11,
+  0xF2, 0x12, 0xF2, 0x12, 0xF2, 0x11, 0xF2, 0x12, 0x10, 0x1F, 0x1C, 0x11,
+  0x21, 0xF1, 0xB1, 0x21, 0xF1, 0xC1, 0x11, 0x23, 0xF2, 0x12, 0xF1, 0x61,
+  0x11, 0x42, 0x21, 0xF1, 0xE2, 0x12, 0xF1, 0x21, 0x11, 0x92, 0x12, 0xF1,
+  0x11, 0xC1, 0x22, 0xF0, 0xD1, 0xF0, 0x02, 0x21, 0xF0, 0xB1, 0x11, 0xF0,
+  0x4F, 0x0B, 0xF2, 0x21, 0xF1, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+  0xF8, 0x61, 0xF2, 0x11, 0xF0, 0x43, 0xF0, 0x46, 0x12, 0xF0, 0x11, 0x32,
+  0xF0, 0x02, 0x62, 0x12, 0xC1, 0x72, 0xC1, 0xD1, 0xA1, 0x11, 0x82, 0x82,
+  0xA1, 0x12, 0x12, 0xF0, 0x61, 0x52, 0xD1, 0x22, 0x13, 0x41, 0x11, 0xF0,
+  0xF1, 0x61, 0x32, 0xF0, 0x11, 0x52, 0xA1, 0x11, 0x63, 0x22, 0x11, 0xA2,
+  0x82, 0xF0, 0x52, 0xC2, 0xC1, 0x61, 0x11, 0xC2, 0x12, 0x52, 0xF0, 0x02,
+  0x51, 0xF0, 0x01, 0x25, 0xF0, 0x44, 0xF0, 0x32, 0xFF, 0xF0, 0xFF, 0xF0,
+  0xFF, 0xF0, 0xFE, 0x61, 0xF1, 0xF1, 0x1F, 0x0B, 0x31, 0xF1, 0xD2, 0x21,
+  0xE1, 0x11, 0xF0, 0xD2, 0x12, 0xF1, 0xE2, 0x12, 0x91, 0x11, 0xF1, 0x21,
+  0x21, 0x91, 0xF1, 0x42, 0x12, 0x51, 0xF1, 0x82, 0x11, 0x31, 0x11, 0xF1,
+  0x91, 0xF2, 0x21, 0x11, 0x11, 0xF1, 0xC0, 0x1F, 0x1C, 0x11, 0x21, 0xF1,
+  0xB1, 0x21, 0xF1, 0xC1, 0x11, 0x23, 0xF2, 0x12, 0xF1, 0x61, 0x11, 0x42,
+  0x21, 0xF1, 0xE2, 0x12, 0xF1, 0x21, 0x11, 0x92, 0x12, 0xF1, 0x11, 0xC1,
+  0x22, 0xF0, 0xD1, 0xF0, 0x02, 0x21, 0xF0, 0xB1, 0x11, 0xF0, 0x4F, 0x0B,
+  0xF2, 0x21, 0xF1, 0xF1, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x61,
+  0xF2, 0x11, 0xF0, 0x43, 0xF0, 0x46, 0x12, 0xF0, 0x11, 0x32, 0xF0, 0x02,
+  0x62, 0x12, 0xC1, 0x72, 0xC1, 0xD1, 0xA1, 0x11, 0x82, 0x82, 0xA1, 0x12,
+  0x12, 0xF0, 0x61, 0x52, 0xD1, 0x22, 0x13, 0x41, 0x11, 0xF0, 0xF1, 0x61,
+  0x32, 0xF0, 0x11, 0x52, 0xA1, 0x11, 0x61, 0x42, 0x11, 0xA2, 0x82, 0xF1,
+  0x32, 0xC1, 0x61, 0x11, 0xF0, 0x02, 0x52, 0xF0, 0x02, 0x51, 0xF0, 0x35,
+  0xF0, 0x44, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF1, 0xDF,
+  0x0B, 0x31, 0xF1, 0xD2, 0x21, 0xF0, 0x11, 0xF0, 0xD2, 0x12, 0xF1, 0xE2,
+  0x12, 0xB1, 0xF1, 0x21, 0x21, 0x91, 0xF1, 0x42, 0x12, 0xF1, 0xE2, 0x11,
+  0x51, 0xF1, 0x91, 0xF2, 0x61, 0xF1, 0xC0, 0x34, 0x42, 0x41, 0xA1, 0x11,
+  0xF0, 0x31, 0xF0, 0x42, 0xF0, 0x21, 0x22, 0x32, 0x53, 0xFC, 0xB2, 0x62,
+  0x22, 0x31, 0x61, 0x11, 0xF0, 0x31, 0xF0, 0x42, 0xF0, 0x21, 0x22, 0x41,
+  0x20 };
+
+constexpr GFXglyph DSEG14Modern_Bold40pt7bSubsetRleGlyphs[] PROGMEM = {
+  {     0,  48,  78,  64,    8,  -77 },   // 0x30 '0'
+  {   185,  10,  74,  64,   46,  -77 },   // 0x31 '1'
+  {   223,  48,  78,  64,    8,  -77 },   // 0x32 '2'
+  {   369,  48,  78,  64,    8,  -77 },   // 0x33 '3'
+  {   517,  48,  74,  64,    8,  -77 },   // 0x34 '4'
+  {   634,  48,  78,  64,    8,  -77 },   // 0x35 '5'
+  {   775,  48,  78,  64,    8,  -77 },   // 0x36 '6'
+  {   926,  48,  74,  64,    8,  -77 },   // 0x37 '7'
+  {  1029,  48,  78,  64,    8,  -77 },   // 0x38 '8'
+  {  1195,  48,  78,  64,    8,  -77 },   // 0x39 '9'
+  {  1351,  10,  42,  16,    3,  -58 } }; // 0x3A ':'
+
+const RleFont DSEG14Modern_Bold40pt7bSubsetRle PROGMEM = {
+  (uint8_t  *)DSEG14Modern_Bold40pt7bSubsetRleRuns,
+  (GFXglyph *)DSEG14Modern_Bold40pt7bSubsetRleGlyphs,
+  0x30, 0x3A, 85 };
+
+// Approx. 1465 bytes
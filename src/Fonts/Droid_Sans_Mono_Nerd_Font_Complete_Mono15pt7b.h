@@ -243,7 +243,7 @@ const uint8_t Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7bBitmaps[] PROGMEM = {
   0x00, 0xE0, 0x1C, 0x03, 0x07, 0xE0, 0xF8, 0x18, 0x00, 0x7E, 0x0F, 0xFF,
   0xF0, 0xFE, 0x00, 0x80 };
 
-const GFXglyph Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,  18,    0,    0 },   // 0x20 ' '
   {     1,   4,  21,  18,    7,  -20 },   // 0x21 '!'
   {    12,  10,   8,  18,    4,  -20 },   // 0x22 '"'
@@ -0,0 +1,122 @@
+#include "Format.h"
+
+/**
+ * Copies the count characters of a field built backwards in reversed,
+ * right aligned to width, returns the length the field needs
+ */
+static size_t emit(char *out, size_t size, const char *reversed, uint8_t count, uint8_t width, char pad) {
+    size_t needed = count < width ? width : count;
+    if (size == 0) {
+        return needed;
+    }
+    size_t length = 0;
+    for (uint8_t i = count; i < width && length + 1 < size; i++) {
+        out[length++] = pad;
+    }
+    while (count > 0 && length + 1 < size) {
+        out[length++] = reversed[--count];
+    }
+    out[length] = '\0';
+    return needed;
+}
+
+/**
+ * Writes the digits of value backwards into reversed, at least minDigits
+ * of them with a point after the first decimals, returns their count
+ */
+static uint8_t reverseDigits(char *reversed, uint32_t value, uint8_t decimals, uint8_t minDigits) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < decimals; i++) {
+        reversed[count++] = (char) ('0' + value % 10);
+        value /= 10;
+    }
+    if (decimals > 0) {
+        reversed[count++] = '.';
+    }
+    uint8_t integral = 0;
+    do {
+        reversed[count++] = (char) ('0' + value % 10);
+        value /= 10;
+        integral++;
+    } while (value > 0 || integral < minDigits);
+    return count;
+}
+
+size_t formatUnsigned(char *out, size_t size, uint32_t value, uint8_t width, char pad) {
+    //Zero padding is produced as digits so it can never exceed the buffer
+    char reversed[24];
+    uint8_t minDigits = pad == '0' && width < 20 ? width : 1;
+    uint8_t count = reverseDigits(reversed, value, 0, minDigits);
+    return emit(out, size, reversed, count, width, ' ');
+}
+
+size_t formatInteger(char *out, size_t size, int32_t value, uint8_t width) {
+    return formatFixed(out, size, value, 0, width);
+}
+
+size_t formatFixed(char *out, size_t size, int32_t value, uint8_t decimals, uint8_t width) {
+    //10 digits, up to 10 decimals, the point and the sign
+    char reversed[24];
+    if (decimals > 10) {
+        decimals = 10;
+    }
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t) value : (uint32_t) value;
+    uint8_t count = reverseDigits(reversed, magnitude, decimals, 1);
+    if (value < 0) {
+        reversed[count++] = '-';
+    }
+    return emit(out, size, reversed, count, width, ' ');
+}
+
+TextWriter::TextWriter(char *buffer, size_t size) : out(buffer), size(size), used(0), overflow(size == 0) {
+    if (size > 0) {
+        out[0] = '\0';
+    }
+}
+
+/**
+ * Moves past a field that needed wanted characters, clamping at the end
+ */
+void TextWriter::advance(size_t wanted) {
+    if (used + wanted >= size) {
+        overflow = true;
+        used = size > 0 ? size - 1 : 0;
+    } else {
+        used += wanted;
+    }
+}
+
+TextWriter &TextWriter::text(const char *s) {
+    size_t wanted = 0;
+    for (; s[wanted] != '\0'; wanted++) {
+        if (used + wanted + 1 < size) {
+            out[used + wanted] = s[wanted];
+        }
+    }
+    if (size > 0) {
+        size_t end = used + wanted;
+        out[end < size ? end : size - 1] = '\0';
+    }
+    advance(wanted);
+    return *this;
+}
+
+TextWriter &TextWriter::character(char c) {
+    char s[2] = {c, '\0'};
+    return text(s);
+}
+
+TextWriter &TextWriter::integer(int32_t value, uint8_t width) {
+    advance(formatInteger(out + used, size - used, value, width));
+    return *this;
+}
+
+TextWriter &TextWriter::zeroPadded(uint32_t value, uint8_t width) {
+    advance(formatUnsigned(out + used, size - used, value, width, '0'));
+    return *this;
+}
+
+TextWriter &TextWriter::fixed(int32_t value, uint8_t decimals, uint8_t width) {
+    advance(formatFixed(out + used, size - used, value, decimals, width));
+    return *this;
+}
@@ -0,0 +1,255 @@
+#include "GlyphBlitter.h"
+
+GlyphBlitter::GlyphBlitter(Display &display) : display(display), runs(0), pixels(0) {
+}
+
+/**
+ * Glyph lookup shared by GFXfont and RleFont, which keep the same table
+ */
+template<class Font>
+static const GFXglyph *lookupGlyph(const Font *font, char c) {
+    uint16_t first = pgm_read_word(&font->first);
+    uint16_t last = pgm_read_word(&font->last);
+    if ((uint8_t) c < first || (uint8_t) c > last) {
+        return nullptr;
+    }
+    GFXglyph *glyphs = (GFXglyph *) pgm_read_ptr(&font->glyph);
+    return &glyphs[(uint8_t) c - first];
+}
+
+template<class Font>
+static void extentOf(const Font *font, int16_t *top, uint16_t *height) {
+    uint16_t first = pgm_read_word(&font->first);
+    uint16_t last = pgm_read_word(&font->last);
+    GFXglyph *glyphs = (GFXglyph *) pgm_read_ptr(&font->glyph);
+
+    int16_t minY = 0;
+    int16_t maxY = 0;
+    for (uint16_t c = first; c <= last; c++) {
+        const GFXglyph *glyph = &glyphs[c - first];
+        int8_t yo = pgm_read_byte(&glyph->yOffset);
+        uint8_t h = pgm_read_byte(&glyph->height);
+        if (yo < minY) {
+            minY = yo;
+        }
+        if (yo + h > maxY) {
+            maxY = yo + h;
+        }
+    }
+    *top = minY;
+    *height = maxY - minY;
+}
+
+const GFXglyph *GlyphBlitter::glyphFor(const GFXfont *font, char c) {
+    return lookupGlyph(font, c);
+}
+
+const GFXglyph *GlyphBlitter::glyphFor(const RleFont *font, char c) {
+    return lookupGlyph(font, c);
+}
+
+void GlyphBlitter::fontExtent(const GFXfont *font, int16_t *top, uint16_t *height) {
+    extentOf(font, top, height);
+}
+
+void GlyphBlitter::fontExtent(const RleFont *font, int16_t *top, uint16_t *height) {
+    extentOf(font, top, height);
+}
+
+void GlyphBlitter::resetStats() {
+    runs = 0;
+    pixels = 0;
+}
+
+int16_t GlyphBlitter::drawChar(const GFXfont *font, int16_t x, int16_t y, char c, uint16_t color) {
+    const GFXglyph *glyph = glyphFor(font, c);
+    if (glyph == nullptr) {
+        return 0;
+    }
+    display.startWrite();
+    blitGlyph(font, glyph, x, y, color);
+    display.endWrite();
+    return pgm_read_byte(&glyph->xAdvance);
+}
+
+int16_t GlyphBlitter::drawText(const GFXfont *font, int16_t x, int16_t y, const char *text, uint16_t color) {
+    display.startWrite();
+    for (; *text != '\0'; text++) {
+        const GFXglyph *glyph = glyphFor(font, *text);
+        if (glyph != nullptr) {
+            blitGlyph(font, glyph, x, y, color);
+            x += pgm_read_byte(&glyph->xAdvance);
+        }
+    }
+    display.endWrite();
+    return x;
+}
+
+/**
+ * Walks the glyph bitmap row by row emitting one line per run of set bits.
+ * Rows are not byte aligned, bits run on continuously across rows.
+ */
+void GlyphBlitter::blitGlyph(const GFXfont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color) {
+    const uint8_t *bitmap = (const uint8_t *) pgm_read_ptr(&font->bitmap);
+    uint16_t offset = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    int8_t xo = pgm_read_byte(&glyph->xOffset);
+    int8_t yo = pgm_read_byte(&glyph->yOffset);
+
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (uint8_t yy = 0; yy < h; yy++) {
+        int16_t runStart = -1;
+        for (uint8_t xx = 0; xx < w; xx++) {
+            if (!(bit++ & 7)) {
+                bits = pgm_read_byte(&bitmap[offset++]);
+            }
+            bool set = bits & 0x80;
+            bits <<= 1;
+            if (set && runStart < 0) {
+                runStart = xx;
+            } else if (!set && runStart >= 0) {
+                display.writeFastHLine(x + xo + runStart, y + yo + yy, xx - runStart, color);
+                runs++;
+                pixels += xx - runStart;
+                runStart = -1;
+            }
+        }
+        if (runStart >= 0) {
+            display.writeFastHLine(x + xo + runStart, y + yo + yy, w - runStart, color);
+            runs++;
+            pixels += w - runStart;
+        }
+    }
+}
+
+int16_t GlyphBlitter::drawCharOpaque(const GFXfont *font, int16_t x, int16_t y, char c, uint16_t fg, uint16_t bg,
+                                     int16_t top, uint16_t height) {
+    const GFXglyph *glyph = glyphFor(font, c);
+    if (glyph == nullptr) {
+        return 0;
+    }
+    display.startWrite();
+    streamCell(font, glyph, x, y, fg, bg, top, height);
+    display.endWrite();
+    return pgm_read_byte(&glyph->xAdvance);
+}
+
+int16_t GlyphBlitter::drawCharOpaque(const RleFont *font, int16_t x, int16_t y, char c, uint16_t fg, uint16_t bg,
+                                     int16_t top, uint16_t height) {
+    const GFXglyph *glyph = glyphFor(font, c);
+    if (glyph == nullptr) {
+        return 0;
+    }
+    display.startWrite();
+    streamCell(font, glyph, x, y, fg, bg, top, height);
+    display.endWrite();
+    return pgm_read_byte(&glyph->xAdvance);
+}
+
+int16_t GlyphBlitter::drawTextOpaque(const GFXfont *font, int16_t x, int16_t y, const char *text, uint16_t fg,
+                                     uint16_t bg, int16_t top, uint16_t height, uint16_t width) {
+    int16_t end = x + width;
+    display.startWrite();
+    for (; *text != '\0'; text++) {
+        const GFXglyph *glyph = glyphFor(font, *text);
+        if (glyph != nullptr) {
+            streamCell(font, glyph, x, y, fg, bg, top, height);
+            x += pgm_read_byte(&glyph->xAdvance);
+        }
+    }
+    if (x < end) {
+        display.writeFillRect(x, y + top, end - x, height, bg);
+        runs++;
+        pixels += (uint32_t) (end - x) * height;
+    }
+    display.endWrite();
+    return x;
+}
+
+/**
+ * Streams the xAdvance wide cell of a glyph one row at a time through a
+ * single address window. Cells that would leave the panel are skipped.
+ */
+void GlyphBlitter::streamCell(const GFXfont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t fg,
+                              uint16_t bg, int16_t top, uint16_t height) {
+    const uint8_t *bitmap = (const uint8_t *) pgm_read_ptr(&font->bitmap);
+    uint16_t offset = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    uint8_t advance = pgm_read_byte(&glyph->xAdvance);
+    int8_t xo = pgm_read_byte(&glyph->xOffset);
+    int8_t yo = pgm_read_byte(&glyph->yOffset);
+
+    int16_t cellY = y + top;
+    if (!cellFits(x, cellY, advance, height)) {
+        return;
+    }
+
+    uint16_t line[maxCellWidth];
+    display.setAddrWindow(x, cellY, advance, height);
+    for (int16_t row = top; row < top + (int16_t) height; row++) {
+        int16_t glyphRow = row - yo;
+        for (int16_t col = 0; col < advance; col++) {
+            int16_t glyphCol = col - xo;
+            bool set = false;
+            if (glyphRow >= 0 && glyphRow < h && glyphCol >= 0 && glyphCol < w) {
+                uint16_t bit = glyphRow * w + glyphCol;
+                set = pgm_read_byte(&bitmap[offset + (bit >> 3)]) & (0x80 >> (bit & 7));
+            }
+            line[col] = set ? fg : bg;
+        }
+        display.writePixels(line, advance);
+        runs++;
+    }
+    pixels += (uint32_t) advance * height;
+}
+
+/**
+ * Same cell as the bitmap version, with the glyph rows decoded one at a
+ * time as the cell reaches them
+ */
+void GlyphBlitter::streamCell(const RleFont *font, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t fg,
+                              uint16_t bg, int16_t top, uint16_t height) {
+    const uint8_t *data = (const uint8_t *) pgm_read_ptr(&font->runs);
+    uint16_t offset = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    uint8_t advance = pgm_read_byte(&glyph->xAdvance);
+    int8_t xo = pgm_read_byte(&glyph->xOffset);
+    int8_t yo = pgm_read_byte(&glyph->yOffset);
+
+    int16_t cellY = y + top;
+    if (!cellFits(x, cellY, advance, height) || w > maxCellWidth) {
+        return;
+    }
+
+    RleGlyphReader reader(data + offset, w);
+    uint8_t bits[maxCellWidth / 8] = {};
+    uint16_t line[maxCellWidth];
+    display.setAddrWindow(x, cellY, advance, height);
+    for (int16_t row = top; row < top + (int16_t) height; row++) {
+        int16_t glyphRow = row - yo;
+        bool inGlyph = glyphRow >= 0 && glyphRow < h;
+        if (inGlyph) {
+            reader.nextRow(bits);
+        }
+        for (int16_t col = 0; col < advance; col++) {
+            int16_t glyphCol = col - xo;
+            bool set = inGlyph && glyphCol >= 0 && glyphCol < w && (bits[glyphCol >> 3] & (0x80 >> (glyphCol & 7)));
+            line[col] = set ? fg : bg;
+        }
+        display.writePixels(line, advance);
+        runs++;
+    }
+    pixels += (uint32_t) advance * height;
+}
+
+/**
+ * True when a cell can be streamed: it fits a line buffer and the panel
+ */
+bool GlyphBlitter::cellFits(int16_t x, int16_t cellY, uint8_t advance, uint16_t height) const {
+    return advance > 0 && advance <= maxCellWidth && x >= 0 && cellY >= 0
+           && x + advance <= display.width() && cellY + height <= display.height();
+}
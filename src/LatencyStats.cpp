@@ -0,0 +1,16 @@
+#include "LatencyStats.h"
+
+LatencyStats::LatencyStats() : samples(0), lastUs(0), minUs(0xFFFFFFFF), maxUs(0), totalUs(0) {
+}
+
+void LatencyStats::add(uint32_t us) {
+    samples++;
+    lastUs = us;
+    totalUs += us;
+    if (us < minUs) {
+        minUs = us;
+    }
+    if (us > maxUs) {
+        maxUs = us;
+    }
+}
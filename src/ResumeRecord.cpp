@@ -0,0 +1,40 @@
+#include <stddef.h>
+#include <string.h>
+#include "ResumeRecord.h"
+#include "Checksum.h"
+
+ResumeRecord::ResumeRecord(Storage &storage, Clock &clock) : storage(storage), clock(clock), age(0) {
+    //Padding included, the checksum covers the raw bytes
+    memset(&data, 0, sizeof(data));
+}
+
+bool ResumeRecord::load() {
+    if (!storage.read(&data, sizeof(data)) || data.magic != dataMagic ||
+        data.crc != crc32(&data, offsetof(Data, crc))) {
+        memset(&data, 0, sizeof(data));
+        return false;
+    }
+    //Counter restarted at power on or wrapped: the difference is useless,
+    //and after a power cycle neither is the screen state
+    age = clock.rtcMillis() - data.rtcMillis;
+    if (age > maxAgeMs) {
+        memset(&data, 0, sizeof(data));
+        return false;
+    }
+    return true;
+}
+
+bool ResumeRecord::save() {
+    if (clock.now() < minValidEpoch) {
+        return false;
+    }
+    data.magic = dataMagic;
+    data.rtcMillis = clock.rtcMillis();
+    data.epochMs = clock.epochMs();
+    data.crc = crc32(&data, offsetof(Data, crc));
+    return storage.write(&data, sizeof(data));
+}
+
+int64_t ResumeRecord::resumedEpochMs() {
+    return data.epochMs + (uint32_t) (clock.rtcMillis() - data.rtcMillis);
+}
@@ -0,0 +1,43 @@
+#include "RleFont.h"
+
+RleGlyphReader::RleGlyphReader(const uint8_t *runs, uint8_t width)
+        : data(runs), width(width), highNibble(true), set(true), remaining(0) {
+}
+
+uint8_t RleGlyphReader::nibble() {
+    uint8_t byte = pgm_read_byte(data);
+    if (highNibble) {
+        highNibble = false;
+        return byte >> 4;
+    }
+    highNibble = true;
+    data++;
+    return byte & 0x0F;
+}
+
+uint16_t RleGlyphReader::runLength() {
+    uint8_t length = nibble();
+    if (length < 15) {
+        return length;
+    }
+    uint8_t high = nibble();
+    return 15 + (high << 4 | nibble());
+}
+
+void RleGlyphReader::nextRow(uint8_t *row) {
+    for (uint8_t x = 0; x < width;) {
+        //Zero length runs only switch the colour
+        while (remaining == 0) {
+            remaining = runLength();
+            set = !set;
+        }
+        uint8_t count = remaining < width - x ? remaining : width - x;
+        if (set) {
+            for (uint8_t i = x; i < x + count; i++) {
+                row[i >> 3] ^= 0x80 >> (i & 7);
+            }
+        }
+        remaining -= count;
+        x += count;
+    }
+}
@@ -0,0 +1,95 @@
+#include "Scheduler.h"
+
+Scheduler::Scheduler(Clock &clock) : clock(clock), tasks(), taskCount(0) {
+}
+
+int8_t Scheduler::add(const char *name, TaskFunction function, uint32_t firstDueMs, uint32_t periodMs) {
+    if (taskCount >= maxTasks) {
+        return -1;
+    }
+    Task &task = tasks[taskCount];
+    task.name = name;
+    task.function = function;
+    task.periodMs = periodMs;
+    task.due = clock.millis() + firstDueMs;
+    task.armed = firstDueMs != never;
+    return taskCount++;
+}
+
+void Scheduler::schedule(int8_t id, uint32_t inMs, bool replace) {
+    Task &task = tasks[id];
+    uint32_t due = clock.millis() + inMs;
+    //Deadlines are compared as signed differences so millis() may wrap
+    if (!task.armed || replace || (int32_t) (due - task.due) < 0) {
+        task.due = due;
+        task.armed = true;
+    }
+}
+
+void Scheduler::runDue() {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        Task &task = tasks[i];
+        uint32_t now = clock.millis();
+        if (!task.armed || (int32_t) (now - task.due) < 0) {
+            continue;
+        }
+
+        uint32_t lateness = now - task.due;
+        task.runs++;
+        task.totalLateness += lateness;
+        if (lateness > task.maxLateness) {
+            task.maxLateness = lateness;
+        }
+
+        if (task.periodMs == 0) {
+            task.armed = false;
+        } else if (lateness < task.periodMs) {
+            task.due += task.periodMs;
+        } else {
+            //Too far behind to catch up, restart the period from now
+            task.due = now + task.periodMs;
+        }
+
+        //Re-armed before running so the task may still move its deadline
+        task.function();
+    }
+}
+
+uint32_t Scheduler::untilNext() {
+    uint32_t now = clock.millis();
+    uint32_t next = never;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const Task &task = tasks[i];
+        if (!task.armed) {
+            continue;
+        }
+        int32_t remaining = (int32_t) (task.due - now);
+        if (remaining <= 0) {
+            return 0;
+        }
+        if ((uint32_t) remaining < next) {
+            next = remaining;
+        }
+    }
+    return next;
+}
+
+void Scheduler::tick() {
+    runDue();
+    uint32_t sleep = untilNext();
+    if (sleep == never) {
+        sleep = 1000;
+    }
+    if (sleep > 0) {
+        clock.delay(sleep);
+    }
+}
+
+void Scheduler::report(Console &console) const {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const Task &task = tasks[i];
+        console.printf("task %-8s runs %lu lateness avg %lu ms max %lu ms\n", task.name, (unsigned long) task.runs,
+                       (unsigned long) (task.runs > 0 ? task.totalLateness / task.runs : 0),
+                       (unsigned long) task.maxLateness);
+    }
+}
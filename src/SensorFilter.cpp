@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "SensorFilter.h"
+
+SensorFilter::SensorFilter(uint8_t medianWindow, uint16_t emaAlpha, int32_t hysteresis)
+        : window(medianWindow < 1 ? 1 : (medianWindow > maxWindow ? maxWindow : medianWindow)),
+          alpha(emaAlpha > alphaOne ? alphaOne : emaAlpha), hysteresis(hysteresis), history(), next(0), filled(0),
+          ema(0), published(0), samples(0), publishes(0) {
+}
+
+/**
+ * Median of the filled part of the window, by insertion sort of a copy
+ */
+int32_t SensorFilter::median() const {
+    int32_t sorted[maxWindow];
+    for (uint8_t i = 0; i < filled; i++) {
+        int32_t v = history[i];
+        uint8_t j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    if (filled % 2 == 1) {
+        return sorted[filled / 2];
+    }
+    return (sorted[filled / 2 - 1] + sorted[filled / 2]) / 2;
+}
+
+bool SensorFilter::add(int32_t sample) {
+    history[next] = sample;
+    next = (next + 1) % window;
+    if (filled < window) {
+        filled++;
+    }
+
+    int32_t m = median();
+    if (samples == 0) {
+        ema = m;
+    } else {
+        //Step rounded half away from zero, but at least one unit towards
+        //m: rounding alone stalls once alpha * |m - ema| < alphaOne / 2
+        int32_t step = (m - ema) * (int32_t) alpha;
+        step = (step >= 0 ? step + alphaOne / 2 : step - alphaOne / 2) / (int32_t) alphaOne;
+        if (step == 0 && m != ema) {
+            step = m > ema ? 1 : -1;
+        }
+        ema += step;
+    }
+    samples++;
+
+    if (publishes == 0 || labs(ema - published) >= hysteresis) {
+        published = ema;
+        publishes++;
+        return true;
+    }
+    return false;
+}
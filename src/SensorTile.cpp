@@ -0,0 +1,44 @@
+#include <string.h>
+#include "SensorTile.h"
+#include "GlyphBlitter.h"
+#include "hal/Colors.h"
+
+SensorTile::SensorTile(TileCompositor &compositor, const GFXfont *font, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                       const char *label)
+        : compositor(compositor), font(font), x(x), y(y), w(w), h(h), name(label),
+          shownValue(), shownBg(0), shown(false), drawn(0), skipped(0) {
+}
+
+void SensorTile::invalidate() {
+    shown = false;
+}
+
+void SensorTile::assumeShown(const char *value, uint16_t bg) {
+    strncpy(shownValue, value, maxValueLength);
+    shownValue[maxValueLength] = '\0';
+    shownBg = bg;
+    shown = true;
+}
+
+bool SensorTile::show(const char *value, uint16_t bg) {
+    if (shown && bg == shownBg && strncmp(value, shownValue, maxValueLength) == 0) {
+        skipped++;
+        return false;
+    }
+
+    //Label centered on the top half, value left aligned below it
+    const GFXglyph *glyph = GlyphBlitter::glyphFor(font, '0');
+    int16_t charWidth = glyph != nullptr ? pgm_read_byte(&glyph->xAdvance) : 0;
+    TileText texts[] = {
+            {name, font, (int16_t) ((w - (int16_t) strlen(name) * charWidth) / 2), 24, ILI9341_BLACK},
+            {value, font, 1, 52, ILI9341_BLACK}
+    };
+    compositor.drawTile(x, y, w, h, bg, ILI9341_WHITE, texts, 2);
+
+    strncpy(shownValue, value, maxValueLength);
+    shownValue[maxValueLength] = '\0';
+    shownBg = bg;
+    shown = true;
+    drawn++;
+    return true;
+}
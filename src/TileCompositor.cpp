@@ -0,0 +1,67 @@
+#include "TileCompositor.h"
+#include "GlyphBlitter.h"
+
+TileCompositor::TileCompositor(Display &display) : display(display) {
+}
+
+void TileCompositor::drawTile(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t bg, uint16_t border,
+                              const TileText *texts, uint8_t textCount) {
+    if (w > lineWidth || x < 0 || y < 0 || x + w > display.width() || y + h > display.height()) {
+        return;
+    }
+
+    display.startWrite();
+    display.setAddrWindow(x, y, w, h);
+    for (uint16_t row = 0; row < h; row++) {
+        if (row == 0 || row == h - 1) {
+            for (uint16_t col = 0; col < w; col++) {
+                line[col] = border;
+            }
+        } else {
+            line[0] = border;
+            for (uint16_t col = 1; col < w - 1; col++) {
+                line[col] = bg;
+            }
+            line[w - 1] = border;
+            for (uint8_t i = 0; i < textCount; i++) {
+                rasterizeText(texts[i], row, w);
+            }
+        }
+        display.writePixels(line, w);
+    }
+    display.endWrite();
+}
+
+/**
+ * Sets the pixels of one tile row covered by the glyphs of text.
+ * Glyphs are clipped to the inside of the border.
+ */
+void TileCompositor::rasterizeText(const TileText &text, int16_t row, uint16_t w) {
+    const uint8_t *bitmap = (const uint8_t *) pgm_read_ptr(&text.font->bitmap);
+    int16_t cursorX = text.x;
+
+    for (const char *c = text.text; *c != '\0'; c++) {
+        const GFXglyph *glyph = GlyphBlitter::glyphFor(text.font, *c);
+        if (glyph == nullptr) {
+            continue;
+        }
+        uint8_t gw = pgm_read_byte(&glyph->width);
+        uint8_t gh = pgm_read_byte(&glyph->height);
+        int8_t xo = pgm_read_byte(&glyph->xOffset);
+        int8_t yo = pgm_read_byte(&glyph->yOffset);
+
+        int16_t glyphRow = row - (text.baseline + yo);
+        if (glyphRow >= 0 && glyphRow < gh) {
+            uint16_t offset = pgm_read_word(&glyph->bitmapOffset);
+            uint16_t bit = glyphRow * gw;
+            for (uint8_t col = 0; col < gw; col++, bit++) {
+                int16_t px = cursorX + xo + col;
+                if (px > 0 && px < (int16_t) w - 1
+                    && (pgm_read_byte(&bitmap[offset + (bit >> 3)]) & (0x80 >> (bit & 7)))) {
+                    line[px] = text.color;
+                }
+            }
+        }
+        cursorX += pgm_read_byte(&glyph->xAdvance);
+    }
+}
@@ -0,0 +1,242 @@
+#include "TimeRenderer.h"
+#include "hal/Platform.h"
+
+enum Segment {
+    segA, segB, segC, segD, segE, segF, segG1, segG2, segH, segI, segJ, segK, segL, segM, segDots
+};
+
+#define SEG(s) (1 << (s))
+
+static const uint16_t allDigitSegments = SEG(segDots) - 1;
+
+/**
+ * The digits the way DSEG14 draws them, with a split middle bar
+ */
+static const uint16_t digitSegments[10] = {
+        SEG(segA) | SEG(segB) | SEG(segC) | SEG(segD) | SEG(segE) | SEG(segF),
+        SEG(segB) | SEG(segC),
+        SEG(segA) | SEG(segB) | SEG(segG1) | SEG(segG2) | SEG(segE) | SEG(segD),
+        SEG(segA) | SEG(segB) | SEG(segG1) | SEG(segG2) | SEG(segC) | SEG(segD),
+        SEG(segF) | SEG(segG1) | SEG(segG2) | SEG(segB) | SEG(segC),
+        SEG(segA) | SEG(segF) | SEG(segG1) | SEG(segG2) | SEG(segC) | SEG(segD),
+        SEG(segA) | SEG(segF) | SEG(segG1) | SEG(segG2) | SEG(segE) | SEG(segC) | SEG(segD),
+        SEG(segA) | SEG(segB) | SEG(segC),
+        SEG(segA) | SEG(segB) | SEG(segC) | SEG(segD) | SEG(segE) | SEG(segF) | SEG(segG1) | SEG(segG2),
+        SEG(segA) | SEG(segB) | SEG(segC) | SEG(segD) | SEG(segF) | SEG(segG1) | SEG(segG2)
+};
+
+TimeRenderer::TimeRenderer(Display &display, const SegmentLayout &layout, int16_t x, int16_t y, uint16_t fg,
+                           uint16_t bg, uint16_t ghost)
+        : display(display), layout(layout), x(x), top(y - layout.height + 1), fg(fg), bg(bg), ghost(ghost),
+          gap(layout.thickness / 4 > 0 ? layout.thickness / 4 : 1), drawnCount(0), lastPixels(0), totalPixels(0),
+          lastSegments(0) {
+}
+
+uint16_t TimeRenderer::segmentsFor(char c) {
+    if (c >= '0' && c <= '9') {
+        return digitSegments[c - '0'];
+    }
+    if (c == '-') {
+        return SEG(segG1) | SEG(segG2);
+    }
+    if (c == ':') {
+        return SEG(segDots);
+    }
+    return 0;
+}
+
+uint16_t TimeRenderer::cellSegmentsFor(char c) {
+    return c == ':' ? SEG(segDots) : allDigitSegments;
+}
+
+void TimeRenderer::invalidate() {
+    drawnCount = 0;
+}
+
+void TimeRenderer::assumeDrawn(const char *text) {
+    int16_t cursorX = x;
+    drawnCount = 0;
+    for (; text[drawnCount] != '\0' && drawnCount < maxCells; drawnCount++) {
+        drawnChars[drawnCount] = text[drawnCount];
+        drawnX[drawnCount] = cursorX;
+        cursorX += layout.advance(text[drawnCount]);
+    }
+}
+
+void TimeRenderer::draw(const char *text) {
+    uint32_t pixels = 0;
+    int16_t cursorX = x;
+    uint8_t count = 0;
+    lastSegments = 0;
+
+    for (; text[count] != '\0' && count < maxCells; count++) {
+        char c = text[count];
+        if (count < drawnCount && drawnX[count] == cursorX &&
+            cellSegmentsFor(drawnChars[count]) == cellSegmentsFor(c)) {
+            //Same kind of cell in the same place: only touch the segments
+            //that changed
+            uint16_t was = segmentsFor(drawnChars[count]);
+            uint16_t lit = segmentsFor(c);
+            pixels += paintSegments(was & ~lit, cursorX, ghost);
+            pixels += paintSegments(lit & ~was, cursorX, fg);
+        } else {
+            if (count < drawnCount) {
+                pixels += eraseCell(drawnChars[count], drawnX[count]);
+            }
+            pixels += drawCell(c, cursorX);
+            drawnX[count] = cursorX;
+        }
+        drawnChars[count] = c;
+        cursorX += layout.advance(c);
+        yield();
+    }
+
+    //Text got shorter: wipe what is left of the old one
+    for (uint8_t i = count; i < drawnCount; i++) {
+        pixels += eraseCell(drawnChars[i], drawnX[i]);
+    }
+    drawnCount = count;
+
+    lastPixels = pixels;
+    totalPixels += pixels;
+}
+
+/**
+ * Blanks what a character drew at cellX: its lit segments, or all of them
+ * when the unlit ones show in the ghost colour
+ */
+uint32_t TimeRenderer::eraseCell(char c, int16_t cellX) {
+    return paintSegments(ghost == bg ? segmentsFor(c) : cellSegmentsFor(c), cellX, bg);
+}
+
+/**
+ * Paints a character into an empty cell at cellX, returns the number of
+ * pixels written
+ */
+uint32_t TimeRenderer::drawCell(char c, int16_t cellX) {
+    uint16_t lit = segmentsFor(c);
+    uint32_t pixels = paintSegments(lit, cellX, fg);
+    if (ghost != bg) {
+        pixels += paintSegments(cellSegmentsFor(c) & ~lit, cellX, ghost);
+    }
+    return pixels;
+}
+
+/**
+ * Fills the given segments of the cell at cellX in one write transaction
+ */
+uint32_t TimeRenderer::paintSegments(uint16_t segments, int16_t cellX, uint16_t color) {
+    if (segments == 0) {
+        return 0;
+    }
+    int16_t left = cellX + layout.spacing / 2;
+    uint32_t pixels = 0;
+    display.startWrite();
+    for (uint8_t s = 0; s < segmentCount; s++) {
+        if (segments & SEG(s)) {
+            pixels += paintSegment(s, left, color);
+            lastSegments++;
+        }
+    }
+    display.endWrite();
+    return pixels;
+}
+
+/**
+ * Fills one segment of the digit whose left edge is at digitX, inside an
+ * open write transaction. Returns the number of pixels written
+ */
+uint32_t TimeRenderer::paintSegment(uint8_t segment, int16_t digitX, uint16_t color) {
+    int16_t t = layout.thickness;
+    int16_t w = layout.width;
+    int16_t h = layout.height;
+    //Middle bar, the inner span between the outer verticals and the two
+    //vertical spans between the bars, each kept gap pixels apart
+    int16_t middle = top + (h - t) / 2;
+    int16_t innerX = digitX + t + gap;
+    int16_t innerW = w - 2 * t - 2 * gap;
+    int16_t halfW = (innerW - gap) / 2;
+    int16_t upperY = top + t + gap;
+    int16_t upperH = middle - gap - upperY;
+    int16_t lowerY = middle + t + gap;
+    int16_t lowerH = top + h - t - gap - lowerY;
+    int16_t centreX = digitX + (w - t) / 2;
+    int16_t quarterW = centreX - gap - innerX;
+    int16_t rightX = digitX + w - t;
+    int16_t bottomY = top + h - t;
+    int16_t rightHalfX = innerX + innerW - halfW;
+
+    struct {
+        int16_t x, y, w, h;
+    } box;
+    switch (segment) {
+        case segA:
+            box = {innerX, top, innerW, t};
+            break;
+        case segB:
+            box = {rightX, upperY, t, upperH};
+            break;
+        case segC:
+            box = {rightX, lowerY, t, lowerH};
+            break;
+        case segD:
+            box = {innerX, bottomY, innerW, t};
+            break;
+        case segE:
+            box = {digitX, lowerY, t, lowerH};
+            break;
+        case segF:
+            box = {digitX, upperY, t, upperH};
+            break;
+        case segG1:
+            box = {innerX, middle, halfW, t};
+            break;
+        case segG2:
+            box = {rightHalfX, middle, halfW, t};
+            break;
+        case segI:
+            box = {centreX, upperY, t, upperH};
+            break;
+        case segL:
+            box = {centreX, lowerY, t, lowerH};
+            break;
+        case segH:
+            return paintDiagonal(innerX, upperY, quarterW, upperH, true, color);
+        case segJ:
+            return paintDiagonal(centreX + t + gap, upperY, quarterW, upperH, false, color);
+        case segK:
+            return paintDiagonal(innerX, lowerY, quarterW, lowerH, false, color);
+        case segM:
+            return paintDiagonal(centreX + t + gap, lowerY, quarterW, lowerH, true, color);
+        case segDots:
+            //Two square dots at a third and two thirds of the height
+            display.writeFillRect(digitX, top + h / 3 - t / 2, t, t, color);
+            display.writeFillRect(digitX, top + h * 2 / 3 - t / 2, t, t, color);
+            return 2 * t * t;
+        default:
+            return 0;
+    }
+    display.writeFillRect(box.x, box.y, box.w, box.h, color);
+    return (uint32_t) box.w * box.h;
+}
+
+/**
+ * Fills a stroke across the box, from its top left to its bottom right
+ * corner when falling, else from its top right to its bottom left, as
+ * one horizontal span per row
+ */
+uint32_t TimeRenderer::paintDiagonal(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, bool falling,
+                                     uint16_t color) {
+    if (boxW <= 0 || boxH <= 0) {
+        return 0;
+    }
+    int16_t span = layout.thickness < boxW ? layout.thickness : boxW;
+    uint32_t pixels = 0;
+    for (int16_t row = 0; row < boxH; row++) {
+        int16_t step = boxH > 1 ? (int16_t) ((int32_t) (boxW - span) * row / (boxH - 1)) : 0;
+        int16_t spanX = falling ? boxX + step : boxX + boxW - span - step;
+        display.writeFastHLine(spanX, boxY + row, span, color);
+        pixels += span;
+    }
+    return pixels;
+}
@@ -0,0 +1,170 @@
+#include <stddef.h>
+#include <string.h>
+#include "WifiLink.h"
+#include "Checksum.h"
+
+static_assert(offsetof(LinkHint, leaseExpiry) + sizeof(uint32_t) == sizeof(LinkHint),
+              "the link comparison takes leaseExpiry for the last member");
+
+WifiLink::WifiLink(Network &network, Clock &clock, Storage &storage)
+        : network(network), clock(clock), storage(storage), hintValid(false), fastAttempt(false),
+          expiryPending(false), leaseStart(0), current(offline),
+          since(0), backoffMs(minBackoffMs), firstConnected(0), attemptCount(0), reconnectCount(0), fastCount(0),
+          lastAttempt(0) {
+}
+
+void WifiLink::begin(const char *ssid, const char *pass) {
+    network.begin(ssid, pass);
+    loadHint();
+    startAttempt(true);
+}
+
+const char *WifiLink::stateName(State state) {
+    switch (state) {
+        case connecting:
+            return "connecting";
+        case connected:
+            return "connected";
+        case backoff:
+            return "backoff";
+        default:
+            return "offline";
+    }
+}
+
+void WifiLink::loadHint() {
+    Record record;
+    hintValid = storage.read(&record, sizeof(record)) && record.magic == recordMagic &&
+                record.crc == crc32(&record.hint, sizeof(record.hint));
+    if (hintValid) {
+        hint = record.hint;
+    }
+}
+
+/**
+ * Takes the hint of a link DHCP has just set up. Its expiry follows once
+ * the wall clock is known, which on a cold boot is only after NTP
+ */
+void WifiLink::storeHint() {
+    memset(&leased, 0, sizeof(leased));
+    expiryPending = network.linkHint(&leased);
+    leaseStart = clock.millis();
+    updateLeaseExpiry();
+}
+
+/**
+ * Dates the pending lease once the wall clock is set, and saves the hint
+ * when the AP, address or lease length differ from the stored one, or
+ * the stored expiry is more than half a lease behind, so flash is not
+ * written on every DHCP connect
+ */
+void WifiLink::updateLeaseExpiry() {
+    time_t now = clock.now();
+    if (!expiryPending || now < Clock::minValidEpoch) {
+        return;
+    }
+    expiryPending = false;
+    leased.leaseExpiry = (uint32_t) (now - (clock.millis() - leaseStart) / 1000) + leased.leaseSeconds;
+    //leaseExpiry is the last member, everything before it is the link
+    bool sameLink = hintValid && memcmp(&leased, &hint, offsetof(LinkHint, leaseExpiry)) == 0;
+    if (sameLink && leased.leaseExpiry - hint.leaseExpiry <= leased.leaseSeconds / 2) {
+        return;
+    }
+    Record record;
+    record.magic = recordMagic;
+    record.hint = leased;
+    record.crc = crc32(&record.hint, sizeof(record.hint));
+    hint = leased;
+    hintValid = storage.write(&record, sizeof(record));
+}
+
+/**
+ * Whether the stored lease can still stand in for DHCP: up to half its
+ * length, when a DHCP client would renew it. Unknown while the wall
+ * clock is not set
+ */
+bool WifiLink::leaseUsable() {
+    time_t now = clock.now();
+    return hintValid && hint.leaseExpiry != 0 && now >= Clock::minValidEpoch &&
+           (uint32_t) now + hint.leaseSeconds / 2 < hint.leaseExpiry;
+}
+
+/**
+ * Goes straight to the stored AP when asked to and the hint allows it,
+ * otherwise scans and asks DHCP
+ */
+void WifiLink::startAttempt(bool fast) {
+    fastAttempt = fast && leaseUsable();
+    network.connect(fastAttempt ? &hint : nullptr);
+    attemptCount++;
+    current = connecting;
+    since = clock.millis();
+}
+
+bool WifiLink::poll(uint32_t *nextMs) {
+    State previous = current;
+    uint32_t elapsed = clock.millis() - since;
+
+    switch (current) {
+        case connecting:
+            if (network.connected()) {
+                if (firstConnected == 0) {
+                    firstConnected = clock.millis();
+                } else {
+                    reconnectCount++;
+                }
+                if (fastAttempt) {
+                    fastCount++;
+                }
+                lastAttempt = elapsed;
+                current = connected;
+                since = clock.millis();
+                backoffMs = minBackoffMs;
+                if (!fastAttempt) {
+                    storeHint();
+                }
+            } else if (fastAttempt && elapsed >= fastTimeoutMs) {
+                //AP moved or not up yet: scan right away, the hint stays
+                //for later attempts
+                network.disconnect();
+                startAttempt(false);
+            } else if (elapsed >= attemptTimeoutMs) {
+                network.disconnect();
+                current = backoffMs >= maxBackoffMs ? offline : backoff;
+                since = clock.millis();
+            }
+            break;
+        case connected:
+            if (!network.connected()) {
+                startAttempt(true);
+            } else if (fastAttempt && !leaseUsable()) {
+                //Time to renew the address the link reuses, through DHCP
+                network.disconnect();
+                startAttempt(false);
+            } else {
+                updateLeaseExpiry();
+            }
+            break;
+        case backoff:
+        case offline:
+            if (elapsed >= backoffMs) {
+                backoffMs = backoffMs < maxBackoffMs / 2 ? backoffMs * 2 : maxBackoffMs;
+                startAttempt(true);
+            }
+            break;
+    }
+
+    elapsed = clock.millis() - since;
+    switch (current) {
+        case connecting:
+            *nextMs = pollMs;
+            break;
+        case connected:
+            *nextMs = checkMs;
+            break;
+        default:
+            *nextMs = elapsed < backoffMs ? backoffMs - elapsed : 0;
+            break;
+    }
+    return current != previous;
+}
@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include "Bh1750LightSensor.h"
+
+#define BH1750_POWER_ON          0x01
+#define BH1750_ONE_TIME_H        0x20
+#define BH1750_ONE_TIME_H2       0x21
+#define BH1750_MTREG_HIGH        0x40
+#define BH1750_MTREG_LOW         0x60
+#define BH1750_DEFAULT_MTREG     69
+#define BH1750_MIN_MTREG         31
+
+/**
+ * From most to least sensitive, 0.11 lx resolution up to ~120 klx
+ */
+const Bh1750LightSensor::Range Bh1750LightSensor::ranges[] = {
+        {BH1750_ONE_TIME_H2, 254, true},
+        {BH1750_ONE_TIME_H2, BH1750_DEFAULT_MTREG, true},
+        {BH1750_ONE_TIME_H, BH1750_DEFAULT_MTREG, false},
+        {BH1750_ONE_TIME_H, BH1750_MIN_MTREG, false},
+};
+
+static_assert(65535UL * 25 * BH1750_DEFAULT_MTREG / (3UL * BH1750_MIN_MTREG) < LightSensor::maxDeciLux,
+              "LightSensor::maxDeciLux is below what the least sensitive range reads");
+const uint8_t Bh1750LightSensor::rangeCount = sizeof(ranges) / sizeof(ranges[0]);
+
+Bh1750LightSensor::Bh1750LightSensor(uint8_t address, uint8_t sda, uint8_t scl)
+        : address(address), sda(sda), scl(scl), range(1), configuredRange(0xFF),
+          measuring(false), valid(false), lux(0) {
+}
+
+void Bh1750LightSensor::begin() {
+    Wire.begin(sda, scl);
+    command(BH1750_POWER_ON);
+}
+
+bool Bh1750LightSensor::command(uint8_t opcode) {
+    Wire.beginTransmission(address);
+    Wire.write(opcode);
+    return Wire.endTransmission() == 0;
+}
+
+/**
+ * Writes MTreg when the range needs a different one than configured
+ */
+bool Bh1750LightSensor::setRange(uint8_t newRange) {
+    range = newRange;
+    uint8_t mtreg = ranges[range].mtreg;
+    if (configuredRange != 0xFF && ranges[configuredRange].mtreg == mtreg) {
+        return true;
+    }
+    if (!command(BH1750_MTREG_HIGH | (mtreg >> 5)) || !command(BH1750_MTREG_LOW | (mtreg & 0x1F))) {
+        configuredRange = 0xFF;
+        return false;
+    }
+    configuredRange = range;
+    return true;
+}
+
+/**
+ * Maximum high resolution measurement time (180 ms) scaled by MTreg
+ */
+uint32_t Bh1750LightSensor::integrationMs() const {
+    return (180UL * ranges[range].mtreg + BH1750_DEFAULT_MTREG - 1) / BH1750_DEFAULT_MTREG;
+}
+
+/**
+ * Moves one range towards sensitivity on weak readings and away from it
+ * near saturation
+ */
+void Bh1750LightSensor::pickRange(uint16_t raw) {
+    if (raw > rangeUpCount && range + 1 < rangeCount) {
+        range++;
+    } else if (raw < rangeDownCount && range > 0) {
+        range--;
+    }
+}
+
+bool Bh1750LightSensor::poll(uint32_t *nextMs) {
+    if (!measuring) {
+        if (!setRange(range) || !command(ranges[range].opcode)) {
+            valid = false;
+            *nextMs = 0;
+            return true;
+        }
+        measuring = true;
+        *nextMs = integrationMs();
+        return false;
+    }
+
+    measuring = false;
+    if (Wire.requestFrom(address, (uint8_t) 2) != 2) {
+        valid = false;
+        return true;
+    }
+    uint16_t raw = Wire.read() << 8;
+    raw |= Wire.read();
+
+    //Counts / 1.2 at the default MTreg, halved again in mode 2. In 0.1 lx
+    //that is counts * 25 / 3, which stays well inside 32 bit. Truncated,
+    //so rounding it to whole lux for display is the only rounding
+    const Range &measured = ranges[range];
+    uint32_t divisor = 3UL * measured.mtreg * (measured.halfCounts ? 2 : 1);
+    lux = (int32_t) (raw * 25UL * BH1750_DEFAULT_MTREG / divisor);
+    valid = true;
+    pickRange(raw);
+    return true;
+}
+
+bool Bh1750LightSensor::readLux(int32_t *deciLux) {
+    *deciLux = lux;
+    return valid;
+}
@@ -0,0 +1,61 @@
+#ifndef BH1750_LIGHT_SENSOR_H
+#define BH1750_LIGHT_SENSOR_H
+
+#include "hal/Sensors.h"
+
+/**
+ * BH1750 driven in one-shot mode straight over I2C.
+ *
+ * Each measurement is a trigger command and, once the integration time
+ * has passed, a two byte read; the sensor powers down in between. The
+ * resolution mode and measurement time register (MTreg) are picked from
+ * the previous reading, so dim rooms get up to 0.11 lx resolution and
+ * direct sunlight does not saturate.
+ */
+class Bh1750LightSensor : public LightSensor {
+public:
+    Bh1750LightSensor(uint8_t address, uint8_t sda, uint8_t scl);
+
+    void begin() override;
+
+    bool poll(uint32_t *nextMs) override;
+
+    bool readLux(int32_t *deciLux) override;
+
+private:
+    /**
+     * A measuring range: trigger opcode, MTreg and whether the mode
+     * reports half counts (high resolution mode 2)
+     */
+    struct Range {
+        uint8_t opcode;
+        uint8_t mtreg;
+        bool halfCounts;
+    };
+
+    static const Range ranges[];
+    static const uint8_t rangeCount;
+
+    //Switch range when the raw count leaves this window
+    static const uint16_t rangeUpCount = 50000;
+    static const uint16_t rangeDownCount = 10000;
+
+    bool command(uint8_t opcode);
+
+    bool setRange(uint8_t range);
+
+    uint32_t integrationMs() const;
+
+    void pickRange(uint16_t raw);
+
+    uint8_t address;
+    uint8_t sda;
+    uint8_t scl;
+    uint8_t range;
+    uint8_t configuredRange;
+    bool measuring;
+    bool valid;
+    int32_t lux;
+};
+
+#endif //BH1750_LIGHT_SENSOR_H
@@ -0,0 +1,118 @@
+#include <Arduino.h>
+#include "DhtClimateSensor.h"
+
+DhtClimateSensor *DhtClimateSensor::receiver = nullptr;
+
+DhtClimateSensor::DhtClimateSensor(uint8_t pin)
+        : pin(pin), state(idle), startedAt(0), valid(false), temperature(0), humidity(0),
+          edges(), edgeCount(0) {
+}
+
+void DhtClimateSensor::begin() {
+    pinMode(pin, INPUT_PULLUP);
+    //Let the first transaction start right away
+    startedAt = millis() - minIntervalMs;
+}
+
+void DhtClimateSensor::temperatureInfo(SensorInfo *info) {
+    strcpy(info->name, "DHT11");
+    info->version = 1;
+    info->sensorId = -1;
+    info->maxValue = 50;
+    info->minValue = 0;
+    info->resolution = 2;
+    info->minDelayUs = minIntervalMs * 1000;
+}
+
+void DhtClimateSensor::humidityInfo(SensorInfo *info) {
+    strcpy(info->name, "DHT11");
+    info->version = 1;
+    info->sensorId = -1;
+    info->maxValue = 80;
+    info->minValue = 20;
+    info->resolution = 5;
+    info->minDelayUs = minIntervalMs * 1000;
+}
+
+void IRAM_ATTR DhtClimateSensor::onFallingEdge() {
+    DhtClimateSensor *sensor = receiver;
+    if (sensor != nullptr && sensor->edgeCount < frameEdges) {
+        sensor->edges[sensor->edgeCount++] = micros();
+    }
+}
+
+bool DhtClimateSensor::poll(uint32_t *nextMs) {
+    switch (state) {
+        case idle: {
+            uint32_t elapsed = millis() - startedAt;
+            if (elapsed < minIntervalMs) {
+                *nextMs = minIntervalMs - elapsed;
+                return false;
+            }
+            //Start signal: hold the line low for at least 18 ms
+            startedAt = millis();
+            pinMode(pin, OUTPUT);
+            digitalWrite(pin, LOW);
+            state = starting;
+            *nextMs = startMs;
+            return false;
+        }
+        case starting:
+            //Release the line and timestamp the reply
+            edgeCount = 0;
+            receiver = this;
+            attachInterrupt(digitalPinToInterrupt(pin), onFallingEdge, FALLING);
+            pinMode(pin, INPUT_PULLUP);
+            state = receiving;
+            *nextMs = frameMs;
+            return false;
+        case receiving:
+        default: {
+            detachInterrupt(digitalPinToInterrupt(pin));
+            receiver = nullptr;
+            valid = decode();
+            state = idle;
+            //The task may run late, never wait longer than the interval
+            uint32_t elapsed = millis() - startedAt;
+            *nextMs = elapsed < minIntervalMs ? minIntervalMs - elapsed : 0;
+            return true;
+        }
+    }
+}
+
+/**
+ * Turns the edge timestamps into the five frame bytes and checks the sum
+ */
+bool DhtClimateSensor::decode() {
+    if (edgeCount < frameEdges) {
+        return false;
+    }
+    uint8_t data[5] = {0, 0, 0, 0, 0};
+    for (uint8_t bit = 0; bit < 40; bit++) {
+        uint32_t period = edges[bit + 2] - edges[bit + 1];
+        data[bit / 8] <<= 1;
+        if (period > oneThresholdUs) {
+            data[bit / 8] |= 1;
+        }
+    }
+    if ((uint8_t) (data[0] + data[1] + data[2] + data[3]) != data[4]) {
+        return false;
+    }
+    //Integral and tenths bytes, kept in hundredths
+    humidity = data[0] * 100 + data[1] * 10;
+    temperature = (data[2] & 0x7F) * 100 + data[3] * 10;
+    if (data[2] & 0x80) {
+        temperature = -temperature;
+    }
+    return true;
+}
+
+bool DhtClimateSensor::readTemperature(int32_t *centiCelsius) {
+    *centiCelsius = temperature;
+    return valid;
+}
+
+bool DhtClimateSensor::readHumidity(int32_t *centiPercent) {
+    *centiPercent = humidity;
+    return valid;
+}
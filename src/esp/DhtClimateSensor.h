@@ -0,0 +1,69 @@
+#ifndef DHT_CLIMATE_SENSOR_H
+#define DHT_CLIMATE_SENSOR_H
+
+#include "hal/Sensors.h"
+
+/**
+ * Interrupt driven DHT11 reader.
+ *
+ * Instead of bit-banging the 40 bit frame with interrupts disabled, the
+ * start pulse is timed by the caller's scheduler and the falling edges
+ * of the reply are timestamped by a GPIO interrupt. The frame is decoded
+ * afterwards from the edge spacing: every bit is a 50 us low followed by
+ * a 26-28 us (0) or 70 us (1) high. One transaction yields temperature
+ * and humidity together.
+ */
+class DhtClimateSensor : public ClimateSensor {
+public:
+    /**
+     * DHT11 needs at least a second between transactions
+     */
+    static const uint32_t minIntervalMs = 1000;
+
+    explicit DhtClimateSensor(uint8_t pin);
+
+    void begin() override;
+
+    void temperatureInfo(SensorInfo *info) override;
+
+    void humidityInfo(SensorInfo *info) override;
+
+    bool poll(uint32_t *nextMs) override;
+
+    bool readTemperature(int32_t *centiCelsius) override;
+
+    bool readHumidity(int32_t *centiPercent) override;
+
+private:
+    enum State {
+        idle,
+        starting,
+        receiving
+    };
+
+    //Response low plus 40 bit starts plus the final low
+    static const uint8_t frameEdges = 42;
+    static const uint8_t startMs = 20;
+    //An all-ones frame takes about 5.1 ms, and a millisecond deadline can
+    //fire up to 1 ms early
+    static const uint8_t frameMs = 8;
+    static const uint8_t oneThresholdUs = 100;
+
+    static void onFallingEdge();
+
+    bool decode();
+
+    uint8_t pin;
+    State state;
+    uint32_t startedAt;
+    bool valid;
+    int32_t temperature;
+    int32_t humidity;
+
+    volatile uint32_t edges[frameEdges];
+    volatile uint8_t edgeCount;
+
+    static DhtClimateSensor *receiver;
+};
+
+#endif //DHT_CLIMATE_SENSOR_H
@@ -0,0 +1,277 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <string.h>
+#include <EEPROM.h>
+#include <ESP8266WiFi.h>
+#include <user_interface.h>
+#include <coredecls.h>
+#include <lwip/dhcp.h>
+#include <lwip/netif.h>
+#include "EspPlatform.h"
+#include "Bh1750LightSensor.h"
+#include "DhtClimateSensor.h"
+
+#define TFT_CS               D2
+#define TFT_DC               D1
+#define LUX_SDA              D4
+#define LUX_SCL              D3
+#define DHTPIN               D9
+
+IliDisplay::IliDisplay(int8_t cs, int8_t dc) : tft(cs, dc) {
+}
+
+void IliDisplay::begin() {
+    tft.begin();
+    tft.setRotation(3);
+}
+
+int16_t IliDisplay::width() const {
+    return tft.width();
+}
+
+int16_t IliDisplay::height() const {
+    return tft.height();
+}
+
+void IliDisplay::startWrite() {
+    tft.startWrite();
+}
+
+void IliDisplay::endWrite() {
+    tft.endWrite();
+}
+
+void IliDisplay::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    tft.setAddrWindow(x, y, w, h);
+}
+
+void IliDisplay::writePixels(const uint16_t *colors, uint32_t len) {
+    tft.writePixels((uint16_t *) colors, len);
+}
+
+void IliDisplay::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    tft.writeFillRect(x, y, w, h, color);
+}
+
+void IliDisplay::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    tft.writeFastHLine(x, y, w, color);
+}
+
+void IliDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    tft.fillRect(x, y, w, h, color);
+}
+
+void IliDisplay::fillScreen(uint16_t color) {
+    tft.fillScreen(color);
+}
+
+void IliDisplay::println(const char *text, uint16_t color, uint8_t size) {
+    tft.setTextColor(color);
+    tft.setTextSize(size);
+    tft.println(text);
+}
+
+time_t EspClock::now() {
+    time_t now;
+    time(&now);
+    return now;
+}
+
+int64_t EspClock::epochMs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t) tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+uint32_t EspClock::millis() {
+    return ::millis();
+}
+
+uint32_t EspClock::micros() {
+    return ::micros();
+}
+
+void EspClock::delay(uint32_t ms) {
+    ::delay(ms);
+}
+
+uint32_t EspClock::rtcMillis() {
+    //The RTC counts slow clock cycles, the calibration is in us per cycle
+    //with 12 fractional bits
+    uint64_t us = ((uint64_t) system_get_rtc_time() * system_rtc_clock_cali_proc()) >> 12;
+    return (uint32_t) (us / 1000);
+}
+
+static bool ntpSynced = false;
+static bool restoring = false;
+
+/**
+ * settimeofday() callback, which also runs for a restored time
+ */
+static void timeSet() {
+    if (!restoring) {
+        ntpSynced = true;
+    }
+}
+
+void EspClock::setEpochMs(int64_t ms) {
+    struct timeval tv;
+    tv.tv_sec = (time_t) (ms / 1000);
+    tv.tv_usec = (suseconds_t) (ms % 1000) * 1000;
+    restoring = true;
+    settimeofday(&tv, nullptr);
+    restoring = false;
+}
+
+void EspClock::setTimezone(long gmtOffsetSec, int daylightOffsetSec) {
+    //The fixed offset configTime applies, as a POSIX TZ
+    char tz[32];
+    long offset = gmtOffsetSec + daylightOffsetSec;
+    snprintf(tz, sizeof(tz), "UTC%c%ld:%02ld", offset > 0 ? '-' : '+', labs(offset) / 3600, labs(offset) % 3600 / 60);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+void EspClock::startSync(long gmtOffsetSec, int daylightOffsetSec, const char *server) {
+    settimeofday_cb(timeSet);
+    configTime(gmtOffsetSec, daylightOffsetSec, server);
+}
+
+bool EspClock::synced() {
+    return ntpSynced;
+}
+
+void EspNetwork::begin(const char *ssid, const char *pass) {
+    WiFi.mode(WIFI_STA);
+    //Reconnects are driven by WifiLink, the SDK retrying on its own would
+    //fight its backoff
+    WiFi.setAutoReconnect(false);
+    //The link hint is kept by WifiLink, no need for the SDK to write its
+    //own copy of the config to flash on every begin
+    WiFi.persistent(false);
+    this->ssid = ssid;
+    this->pass = pass;
+}
+
+void EspNetwork::connect(const LinkHint *hint) {
+    if (hint != nullptr) {
+        WiFi.config(IPAddress(hint->ip), IPAddress(hint->gateway), IPAddress(hint->subnet), IPAddress(hint->dns));
+        WiFi.begin(ssid, pass, hint->channel, hint->bssid);
+    } else {
+        //Back to DHCP
+        WiFi.config(0u, 0u, 0u);
+        WiFi.begin(ssid, pass);
+    }
+}
+
+void EspNetwork::disconnect() {
+    WiFi.disconnect();
+}
+
+bool EspNetwork::connected() {
+    return WiFi.status() == WL_CONNECTED;
+}
+
+bool EspNetwork::linkHint(LinkHint *hint) {
+    if (!connected()) {
+        return false;
+    }
+    memcpy(hint->bssid, WiFi.BSSID(), sizeof(hint->bssid));
+    hint->channel = WiFi.channel();
+    hint->ip = WiFi.localIP();
+    hint->gateway = WiFi.gatewayIP();
+    hint->subnet = WiFi.subnetMask();
+    hint->dns = WiFi.dnsIP();
+    //The lease as offered to lwIP's DHCP client on the station interface
+    const struct dhcp *dhcp = netif_default != nullptr ? netif_dhcp_data(netif_default) : nullptr;
+    hint->leaseSeconds = dhcp != nullptr && dhcp->offered_t0_lease != 0 ? dhcp->offered_t0_lease
+                                                                        : unknownLeaseSeconds;
+    return true;
+}
+
+void EspNetwork::localIP(char *buffer, size_t size) {
+    IPAddress ip = WiFi.localIP();
+    snprintf(buffer, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+EepromStorage::EepromStorage(size_t capacity) : capacity(capacity), started(false) {
+}
+
+/**
+ * EEPROM.begin copies the flash sector to RAM, only done on first use
+ */
+void EepromStorage::start() {
+    if (!started) {
+        EEPROM.begin(capacity);
+        started = true;
+    }
+}
+
+bool EepromStorage::read(void *data, size_t size) {
+    if (size > capacity) {
+        return false;
+    }
+    start();
+    uint8_t *bytes = (uint8_t *) data;
+    for (size_t i = 0; i < size; i++) {
+        bytes[i] = EEPROM.read(i);
+    }
+    return true;
+}
+
+bool EepromStorage::write(const void *data, size_t size) {
+    if (size > capacity) {
+        return false;
+    }
+    start();
+    const uint8_t *bytes = (const uint8_t *) data;
+    for (size_t i = 0; i < size; i++) {
+        EEPROM.write(i, bytes[i]);
+    }
+    //Only erases and writes the sector when a byte actually changed
+    return EEPROM.commit();
+}
+
+/**
+ * Offset in 4 byte blocks, the first 128 bytes of user RTC memory hold
+ * the OTA command for eboot
+ */
+const uint32_t rtcFirstBlock = 32;
+const size_t rtcUserBytes = 512;
+
+bool RtcStorage::read(void *data, size_t size) {
+    return size % 4 == 0 && size <= rtcUserBytes - rtcFirstBlock * 4 &&
+           ESP.rtcUserMemoryRead(rtcFirstBlock, (uint32_t *) data, size);
+}
+
+bool RtcStorage::write(const void *data, size_t size) {
+    return size % 4 == 0 && size <= rtcUserBytes - rtcFirstBlock * 4 &&
+           ESP.rtcUserMemoryWrite(rtcFirstBlock, (uint32_t *) data, size);
+}
+
+void SerialConsole::begin(unsigned long baud) {
+    Serial.begin(baud);
+}
+
+void SerialConsole::printf(const char *format, ...) {
+    char buffer[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    Serial.print(buffer);
+}
+
+Platform &platform() {
+    static IliDisplay display(TFT_CS, TFT_DC);
+    static DhtClimateSensor climate(DHTPIN);
+    static Bh1750LightSensor light(0x23, LUX_SDA, LUX_SCL);
+    static EspClock clock;
+    static EspNetwork network;
+    static EepromStorage flash(64);
+    static RtcStorage rtc;
+    static SerialConsole console;
+    static Platform instance = {display, climate, light, clock, network, flash, rtc, console};
+    return instance;
+}
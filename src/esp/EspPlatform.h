@@ -0,0 +1,135 @@
+#ifndef ESP_PLATFORM_H
+#define ESP_PLATFORM_H
+
+#include <Adafruit_ILI9341.h>
+#include "hal/Platform.h"
+
+/**
+ * ILI9341 panel over hardware SPI
+ */
+class IliDisplay : public Display {
+public:
+    IliDisplay(int8_t cs, int8_t dc);
+
+    void begin() override;
+
+    int16_t width() const override;
+
+    int16_t height() const override;
+
+    void startWrite() override;
+
+    void endWrite() override;
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+    void writePixels(const uint16_t *colors, uint32_t len) override;
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void fillScreen(uint16_t color) override;
+
+    void println(const char *text, uint16_t color, uint8_t size) override;
+
+private:
+    Adafruit_ILI9341 tft;
+};
+
+/**
+ * System time kept by the SDK, synchronised over SNTP
+ */
+class EspClock : public Clock {
+public:
+    time_t now() override;
+
+    int64_t epochMs() override;
+
+    uint32_t millis() override;
+
+    uint32_t micros() override;
+
+    void delay(uint32_t ms) override;
+
+    uint32_t rtcMillis() override;
+
+    void setEpochMs(int64_t ms) override;
+
+    void setTimezone(long gmtOffsetSec, int daylightOffsetSec) override;
+
+    void startSync(long gmtOffsetSec, int daylightOffsetSec, const char *server) override;
+
+    bool synced() override;
+};
+
+/**
+ * Station mode WiFi, connecting in the background through WiFi.begin
+ */
+class EspNetwork : public Network {
+public:
+    /**
+     * Assumed when DHCP did not say, shorter than most routers hand out
+     */
+    static const uint32_t unknownLeaseSeconds = 3600;
+
+    void begin(const char *ssid, const char *pass) override;
+
+    void connect(const LinkHint *hint) override;
+
+    void disconnect() override;
+
+    bool connected() override;
+
+    bool linkHint(LinkHint *hint) override;
+
+    void localIP(char *buffer, size_t size) override;
+
+private:
+    const char *ssid;
+    const char *pass;
+};
+
+/**
+ * Storage in the flash sector the EEPROM library emulates, survives
+ * power loss
+ */
+class EepromStorage : public Storage {
+public:
+    explicit EepromStorage(size_t capacity);
+
+    bool read(void *data, size_t size) override;
+
+    bool write(const void *data, size_t size) override;
+
+private:
+    void start();
+
+    size_t capacity;
+    bool started;
+};
+
+/**
+ * Storage in the RTC user memory, kept across resets and deep sleep but
+ * lost on power loss. Sizes must be a multiple of 4 bytes
+ */
+class RtcStorage : public Storage {
+public:
+    bool read(void *data, size_t size) override;
+
+    bool write(const void *data, size_t size) override;
+};
+
+/**
+ * Console on the hardware serial port
+ */
+class SerialConsole : public Console {
+public:
+    void begin(unsigned long baud) override;
+
+    void printf(const char *format, ...) override;
+};
+
+#endif //ESP_PLATFORM_H
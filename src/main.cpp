@@ -1,25 +1,22 @@
-#include <SPI.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_ILI9341.h>
-#include <ESP8266WiFi.h>
-#include <ESP8266WiFiMulti.h>
-#include "time.h"
-#include <Fonts/DSEG14Modern_Bold40pt7b.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include "hal/Platform.h"
+#include "hal/Colors.h"
+#include "hal/GfxFont.h"
 #include <Fonts/Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b.h>
-#include <Wire.h>
-#include <BH1750.h>
-#include <Adafruit_Sensor.h>
-#include <DHT.h>
-#include <DHT_U.h>
-
-#define TFT_CS               D2
-#define TFT_DC               D1
-#define LUX_SDA              D4
-#define LUX_SCL              D3
-#define DHTPIN               D9
-#define DHTTYPE              DHT11
-
-//const int DHT_OUT = 27;
+#include "CalendarCache.h"
+#include "FontMetrics.h"
+#include "Format.h"
+#include "GlyphBlitter.h"
+#include "LatencyStats.h"
+#include "ResumeRecord.h"
+#include "Scheduler.h"
+#include "SensorFilter.h"
+#include "SensorTile.h"
+#include "TileCompositor.h"
+#include "TimeRenderer.h"
+#include "WifiLink.h"
 
 const char *ntpServer = "pool.ntp.org";
 const long gmtOffset_sec = 3600;
@@ -32,32 +29,142 @@ const int xTime = 21;
 const int yTime = 104;
 const int tftBG = ILI9341_BLACK;
 const int tftTimeFG = ILI9341_RED;
+const int tftTimeGhost = tftBG; //Unlit segments, e.g. 0x2000 for a dim red LCD look
+const int yTile = 170;
+const int wTile = 92;
+const int hTile = 60;
+const int xTempTile = 14;
+const int xHumiTile = 113;
+const int xLuxTile = 212;
+const int xDate = 16;
+const int yDate = yTime + 40;
+//Square in the top right corner while the time has not come from NTP
+const int xSyncMark = 306;
+const int ySyncMark = 6;
+const int sizeSyncMark = 8;
+const int tftSyncMark = ILI9341_LORANGE;
+
+/**
+ * Panel size after setRotation(3)
+ */
+const int tftWidth = 320;
+const int tftHeight = 240;
+
+/**
+ * 14-segment time digits: width, height, stroke and spacing. Sized like
+ * the DSEG14 40pt glyphs they replace, 64 px per digit
+ */
+constexpr SegmentLayout timeLayout = {48, 78, 9, 16};
+
+/**
+ * Text metrics of the fixed layout, all known at compile time
+ */
+constexpr FontMetrics textFont(Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7bGlyphs, 0x20);
+constexpr uint16_t dateWidth = textFont.width("Wed, 31 Sep 2020");
+constexpr int16_t dateTop = textFont.top();
+constexpr uint16_t dateHeight = textFont.height();
+
+static_assert(timeLayout.valid(), "time segments do not fit their digits");
+static_assert(textFont.maxAdvance() <= GlyphBlitter::maxCellWidth, "text glyphs wider than a blitter cell");
+static_assert(xTime + timeLayout.textWidth("00:00") <= tftWidth, "time does not fit the panel width");
+static_assert(yTime - timeLayout.height + 1 >= 0, "time is cut at the top of the panel");
+static_assert(yTime < yDate + dateTop, "time overlaps the date");
+static_assert(xDate + dateWidth <= tftWidth, "date does not fit the panel width");
+static_assert(yDate + dateTop + dateHeight <= yTile, "date overlaps the tiles");
+static_assert(xLuxTile + wTile <= tftWidth && yTile + hTile <= tftHeight, "tiles do not fit the panel");
+static_assert(xSyncMark + sizeSyncMark <= tftWidth, "sync mark does not fit the panel width");
+static_assert(ySyncMark + sizeSyncMark <= yTime - timeLayout.height + 1, "sync mark overlaps the time");
+
+/**
+ * Characters of a tile value, drawn one pixel in from the tile edge
+ */
+const uint8_t tileChars = 5;
+
+char prevTime[6] = "";
+char currTime[6] = "";
+char shownDate[CalendarCache::maxDateLength + 1] = "";
+bool syncMarkShown = false;
 
-String prevTime = "";
-String currTime = "";
-String prevDate = "";
-String currDate = "";
+static_assert(sizeof(currTime) >= sizeof("23:59"), "time buffer too small");
+static_assert(sizeof(currTime) <= sizeof(ResumeRecord::Snapshot::time), "time does not fit the resume record");
+static_assert(1 + tileChars * textFont.advance('0') <= wTile, "tile values do not fit their tiles");
+/**
+ * Brightest illuminance the tile shows in lx, above it in klx with a k
+ */
+const uint32_t maxTileLux = 99999;
+
+//DHT11 reads 0-50 °C and 20-90 %, the BH1750 up to LightSensor::maxDeciLux
+static_assert(fieldChars(5000, 2) <= tileChars, "temperature does not fit its tile");
+static_assert(fieldChars(9000, 2) <= tileChars, "humidity does not fit its tile");
+static_assert(fieldChars(maxTileLux) <= tileChars, "illuminance does not fit its tile");
+static_assert(fieldChars((LightSensor::maxDeciLux / 10 + 500) / 1000) + 1 <= tileChars,
+              "kilolux do not fit their tile");
 
-float prevTemp = 0;
-float currTemp = 0;
-float prevHumi = 0;
-float currHumi = 0;
+/**
+ * Sensor values in fixed point: 0.01 °C, 0.01 % and 0.1 lx
+ */
+int32_t prevTemp = 0;
+int32_t currTemp = 0;
+int32_t prevHumi = 0;
+int32_t currHumi = 0;
 
-float prevLux = 0;
-float currLux = 0;
+int32_t prevLux = 0;
+int32_t currLux = 0;
+
+/**
+ * Per sensor median window, EMA factor in 1/256 and the change in sensor
+ * units that is worth a redraw
+ */
+SensorFilter tempFilter(3, SensorFilter::alphaOne, 20);
+SensorFilter humiFilter(3, SensorFilter::alphaOne, 100);
+SensorFilter luxFilter(5, 77, 20);
 
 bool onWifi = false;
-String weekDays[] = {"", "Mon", "Thu", "Wed", "Thu", "Fri", "Sat", "Sun"};
-String months[] = {"", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+bool timeSynced = false;
+uint32_t firstFrameMs = 0;
 uint32_t delayMS;
-ESP8266WiFiMulti WiFiMulti;
-Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC);
-BH1750 lightMeter(0x23);
-DHT_Unified dht(DHTPIN, DHTTYPE);
 
-#define ILI9341_LORANGE      0xFC08
-#define ILI9341_LGREEN       0x87F0
-#define ILI9341_LCYAN        0x0418
+/**
+ * Time between one-shot light measurements
+ */
+const uint32_t luxIntervalMs = 1000;
+const uint32_t statsIntervalMs = 600000;
+
+/**
+ * Next minute boundary the time task aims for, 0 until the first refresh,
+ * and micros() at the boundary whose update is being drawn
+ */
+int64_t nextMinuteMs = 0;
+uint32_t boundaryMicros = 0;
+bool boundaryPending = false;
+LatencyStats minuteLatency;
+
+bool timeDirty = false;
+bool dateDirty = false;
+bool syncDirty = false;
+bool tempDirty = false;
+bool humiDirty = false;
+bool luxDirty = false;
+
+Platform &hw = platform();
+Display &tft = hw.display;
+Console &console = hw.console;
+GlyphBlitter blitter(tft);
+TileCompositor compositor(tft);
+SensorTile tempTile(compositor, &Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b, xTempTile, yTile, wTile, hTile, "TEMP");
+SensorTile humiTile(compositor, &Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b, xHumiTile, yTile, wTile, hTile, "H.R.");
+SensorTile luxTile(compositor, &Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b, xLuxTile, yTile, wTile, hTile, "LUX");
+TimeRenderer timeRenderer(tft, timeLayout, xTime, yTime, tftTimeFG, tftBG, tftTimeGhost);
+CalendarCache calendar;
+WifiLink wifi(hw.network, hw.clock, hw.flash);
+ResumeRecord resume(hw.rtc, hw.clock);
+Scheduler scheduler(hw.clock);
+int8_t timeTask;
+int8_t climateTask;
+int8_t lightTask;
+int8_t renderTask;
+int8_t statsTask;
+int8_t wifiTask;
 
 #ifndef WIFI_SSID
 #define WIFI_SSID "my ssid"
@@ -67,16 +174,24 @@ DHT_Unified dht(DHTPIN, DHTTYPE);
 #define WIFI_PASS "password"
 #endif
 
-bool wifiConnect();
+/**
+ * Fast boot goes straight to the clock; build with -D FAST_BOOT=0 for
+ * the diagnostics screen with the sensor details
+ */
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
 
 bool getNtpTime();
 
-String refreshTime();
+const char *refreshTime();
 
 void displayTime();
 
 void displayDate();
 
+void displaySyncMark();
+
 void displayTemp();
 
 void displayHumi();
@@ -89,157 +204,369 @@ void tempChanged();
 
 void humiChanged();
 
-float getCurrentLux();
+int32_t getCurrentLux();
+
+int32_t getCurrentTemp();
+
+int32_t getCurrentHumi();
+
+void bootPhase(const char *phase);
+
+#if !FAST_BOOT
+
+void showBootScreen();
+
+void printSensorInfo(const char *title, const SensorInfo &info, const char *unit);
+
+#endif
+
+void timeTick();
+
+void climateTick();
+
+void lightTick();
+
+void render();
 
-float getCurrentTemp();
+void reportStats();
 
-float getCurrentHumi();
+void wifiTick();
 
-void printTempSensorInfo(const sensor_t &sensor);
+void restoreState(ResumeRecord::Snapshot &saved);
 
-void printHumiditySensorInfo(const sensor_t &sensor);
+void forgetScreen();
+
+void rememberState();
 
 void setup() {
-    Serial.begin(115200);
+    console.begin(115200);
+    bootPhase("console");
+
+    //Show the time from before a soft reset until NTP has answered
+    hw.clock.setTimezone(gmtOffset_sec, daylightOffset_sec);
+    bool resumed = hw.clock.now() < ResumeRecord::minValidEpoch && resume.load();
+    if (resumed) {
+        hw.clock.setEpochMs(resume.resumedEpochMs());
+        console.printf("boot: resumed time saved %lu ms ago\n", (unsigned long) resume.ageMs());
+    }
+    bootPhase("clock");
+
+    //Associates in the background while the rest comes up, NTP starts
+    //once the link is up
+    wifi.begin(WIFI_SSID, WIFI_PASS);
+    bootPhase("wifi");
+
     tft.begin();
-    tft.setRotation(3);
     yield();
-    Wire.begin(LUX_SDA, LUX_SCL);
+    bootPhase("display");
+
+    hw.light.begin();
+    hw.climate.begin();
+    SensorInfo sensor;
+    hw.climate.humidityInfo(&sensor);
+    delayMS = sensor.minDelayUs / 1000;
+    bootPhase("sensors");
+
+#if !FAST_BOOT
+    showBootScreen();
+    bootPhase("boot screen");
+#endif
 
+    timeTask = scheduler.add("time", timeTick, 0, 0);
+    climateTask = scheduler.add("climate", climateTick, 0, 0);
+    lightTask = scheduler.add("light", lightTick, 0, 0);
+    renderTask = scheduler.add("render", render, Scheduler::never, 0);
+    statsTask = scheduler.add("stats", reportStats, statsIntervalMs, statsIntervalMs);
+    wifiTask = scheduler.add("wifi", wifiTick, 0, 0);
+
+    //Prepare screen for normal operation. After a soft reset the panel
+    //still shows the last frame, which is then only patched up
+    tft.profile("boot");
+    if (resumed) {
+        restoreState(resume.snapshot());
+    }
+    bool clearScreen = !resume.snapshot().screenValid;
+    forgetScreen();
+    if (clearScreen) {
+        tft.fillScreen(ILI9341_BLACK);
+        yield();
+    }
+    refreshTime();
+    syncDirty = tempDirty = humiDirty = luxDirty = true;
+    render();
+    firstFrameMs = hw.clock.millis();
+    bootPhase("first frame");
+}
+
+/**
+ * Logs how far into the boot a phase ended, so a slower boot shows up
+ */
+void bootPhase(const char *phase) {
+    console.printf("boot: %s done at %lu us\n", phase, (unsigned long) hw.clock.micros());
+}
 
-    //Boot screen
+#if !FAST_BOOT
+
+/**
+ * Diagnostics screen listing the devices and sensor limits, kept up long
+ * enough to be read
+ */
+void showBootScreen() {
+    //The last frame from before a reset is gone now
+    resume.snapshot().screenValid = false;
     tft.fillScreen(ILI9341_BLACK);
     yield();
-    tft.setTextSize(4);
-    tft.setTextColor(ILI9341_LORANGE);
-    tft.println("Larusso");
-    tft.setTextSize(1);
-    tft.setTextColor(ILI9341_WHITE);
-    tft.println("");
-    tft.println("Booting...");
-    tft.println("Setting up devices...");
-
-    tft.setTextColor(ILI9341_LORANGE);
-    tft.println("Connecting to WiFi AP ");
-    tft.setTextColor(ILI9341_WHITE);
-    tft.println(WIFI_SSID);
-
-    /**
-     * Wifi connect
-     */
-    delay(100);
-
-    wifiConnect();
-    if (onWifi) {
-        tft.print("   Connection succeed, obtained IP ");
-        tft.println(WiFi.localIP());
-    } else {
-        tft.println("   Connection failed. Unexpected operation results.");
-    }
+    tft.println("Larusso", ILI9341_LORANGE, 4);
+    tft.println("", ILI9341_WHITE);
+    tft.println("Booting...", ILI9341_WHITE);
+    tft.println("Setting up devices...", ILI9341_WHITE);
+    tft.println("Connecting to WiFi AP ", ILI9341_LORANGE);
+    tft.println(WIFI_SSID, ILI9341_WHITE);
+    tft.println("Setup Light meter.", ILI9341_WHITE);
+    tft.println("Setup Temperature sensor.", ILI9341_WHITE);
+
+    SensorInfo sensor;
+    hw.climate.temperatureInfo(&sensor);
+    printSensorInfo("Temperature Sensor", sensor, "C");
+
+    hw.clock.delay(1000);
+    tft.println("Setup Humidity sensor.", ILI9341_WHITE);
+    hw.climate.humidityInfo(&sensor);
+    printSensorInfo("Humidity Sensor", sensor, "%");
+
+    tft.println("End of booting process.", ILI9341_WHITE);
+
+    hw.clock.delay(10000);
+}
 
-    /**
-     * NTP Time
-     */
-    tft.println("Obtaining NTP time from remote server...");
-    getNtpTime();
-    delay(100); //We need a delay to allow info propagation
+/**
+ * Prints the description of a sensor on the boot screen
+ */
+void printSensorInfo(const char *title, const SensorInfo &info, const char *unit) {
+    char line[48];
+    tft.println(title, ILI9341_WHITE);
+    tft.println(TextWriter(line).text("Sensor Type: ").text(info.name).c_str(), ILI9341_WHITE);
+    tft.println(TextWriter(line).text("Driver Ver:  ").integer(info.version).c_str(), ILI9341_WHITE);
+    tft.println(TextWriter(line).text("Unique ID:   ").integer(info.sensorId).c_str(), ILI9341_WHITE);
+    //Boot only, so the float limits are simply rounded to hundredths
+    tft.println(TextWriter(line).text("Max Value:   ").fixed(lroundf(info.maxValue * 100), 2).text(unit).c_str(),
+                ILI9341_WHITE);
+    tft.println(TextWriter(line).text("Min Value:   ").fixed(lroundf(info.minValue * 100), 2).text(unit).c_str(),
+                ILI9341_WHITE);
+    tft.println(TextWriter(line).text("Resolution:  ").fixed(lroundf(info.resolution * 100), 2).text(unit).c_str(),
+                ILI9341_WHITE);
+}
 
-    //Set up Lightmeter
-    tft.println("Setup Light meter.");
-    lightMeter.begin(BH1750::Mode::CONTINUOUS_HIGH_RES_MODE_2);
+#endif
 
-    tft.println("Setup Temperature sensor.");
-    dht.begin();
-    sensor_t sensor;
+void loop() {
+    scheduler.tick();
+}
 
-    dht.temperature().getSensor(&sensor);
-    printTempSensorInfo(sensor);
+/**
+ * Task: refreshes the time exactly at the minute boundary and sleeps
+ * until the next one. The boundary's micros() is kept so the render task
+ * can measure how long after it the new minute was on screen.
+ */
+void timeTick() {
+    int64_t nowMs = hw.clock.epochMs();
+    int64_t earlyMs = nextMinuteMs - nowMs;
+    if (earlyMs > 0 && earlyMs <= 60000) {
+        //millis() and the wall clock drift apart, woke up slightly early
+        scheduler.schedule(timeTask, earlyMs, true);
+        return;
+    }
 
-    delay(1000);
-    tft.println("Setup Humidity sensor.");
-    dht.humidity().getSensor(&sensor);
-    printHumiditySensorInfo(sensor);
+    uint32_t intoMinuteMs = nowMs % 60000;
+    //The first refresh after boot or a clock step is not a boundary
+    boundaryPending = nextMinuteMs != 0 && earlyMs > -60000;
+    boundaryMicros = hw.clock.micros() - intoMinuteMs * 1000;
+    nextMinuteMs = nowMs - intoMinuteMs + 60000;
 
-    delayMS = sensor.min_delay / 1000;
+    refreshTime();
+    //RTC memory takes the write every minute, unlike flash
+    resume.save();
+    scheduler.schedule(timeTask, nextMinuteMs - hw.clock.epochMs(), true);
+}
 
-    tft.println("End of booting process.");
+/**
+ * Task: drives the DHT transaction, which asks to be called again after
+ * the start pulse, after the reply and then after its minimum interval
+ */
+void climateTick() {
+    uint32_t nextMs = delayMS;
+    if (hw.climate.poll(&nextMs)) {
+        getCurrentHumi();
+        getCurrentTemp();
+    }
+    scheduler.schedule(climateTask, nextMs, true);
+}
 
-    delay(10000);
+/**
+ * Task: triggers a light measurement, collects it once the integration
+ * time has passed and idles until the next one
+ */
+void lightTick() {
+    uint32_t nextMs;
+    if (hw.light.poll(&nextMs)) {
+        getCurrentLux();
+        nextMs = luxIntervalMs;
+    }
+    scheduler.schedule(lightTask, nextMs, true);
+}
 
-    //Prepare screen for normal operation
-    tft.fillScreen(ILI9341_BLACK);
-    yield();
-    displayTime();
-    displayDate();
-    displayTemp();
-    displayHumi();
-    displayLux();
-}
-
-void printHumiditySensorInfo(const sensor_t &sensor) {
-    tft.println("Humidity Sensor");
-    tft.print("Sensor Type: ");
-    tft.println(sensor.name);
-    tft.print("Driver Ver: ");
-    tft.println(sensor.version);
-    tft.print("Unique ID: ");
-    tft.println(sensor.sensor_id);
-    tft.print("Max Value: ");
-    tft.print(sensor.max_value);
-    tft.println("%");
-    tft.print("Min Value: ");
-    tft.print(sensor.min_value);
-    tft.println("%");
-    tft.print("Resolution: ");
-    tft.print(sensor.resolution);
-    tft.println("%");
-}
-
-void printTempSensorInfo(const sensor_t &sensor) {
-    tft.println("Temperature Sensor");
-    tft.print("Sensor Type: ");
-    tft.println(sensor.name);
-    tft.print("Driver Ver:  ");
-    tft.println(sensor.version);
-    tft.print("Unique ID:   ");
-    tft.println(sensor.sensor_id);
-    tft.print("Max Value:   ");
-    tft.print(sensor.max_value);
-    tft.println("C");
-    tft.print("Min Value:   ");
-    tft.print(sensor.min_value);
-    tft.println("C");
-    tft.print("Resolution:  ");
-    tft.print(sensor.resolution);
-    tft.println("C");
+/**
+ * Task: draws whatever changed since the last render
+ */
+void render() {
+    if (timeDirty || dateDirty || syncDirty || tempDirty || humiDirty || luxDirty) {
+        forgetScreen();
+    }
+    if (timeDirty) {
+        timeDirty = false;
+        displayTime();
+    }
+    if (dateDirty) {
+        dateDirty = false;
+        displayDate();
+    }
+    if (syncDirty) {
+        syncDirty = false;
+        displaySyncMark();
+    }
+    if (boundaryPending) {
+        boundaryPending = false;
+        minuteLatency.add(hw.clock.micros() - boundaryMicros);
+        console.printf("minute latency: %lu us (min %lu avg %lu max %lu)\n",
+                       (unsigned long) minuteLatency.last(), (unsigned long) minuteLatency.min(),
+                       (unsigned long) minuteLatency.avg(), (unsigned long) minuteLatency.max());
+    }
+    if (tempDirty) {
+        tempDirty = false;
+        displayTemp();
+    }
+    if (humiDirty) {
+        humiDirty = false;
+        displayHumi();
+    }
+    if (luxDirty) {
+        luxDirty = false;
+        displayLux();
+    }
+    rememberState();
 }
 
-void loop() {
-    refreshTime();
-    getCurrentLux();
-    getCurrentHumi();
-    getCurrentTemp();
-    delay(delayMS);
+/**
+ * Takes over the sensor values from before a reset and, while the panel
+ * still shows it, the screen contents, so the first frame only redraws
+ * what differs from them
+ */
+void restoreState(ResumeRecord::Snapshot &saved) {
+    prevTemp = saved.temp.previous;
+    currTemp = saved.temp.value;
+    prevHumi = saved.humi.previous;
+    currHumi = saved.humi.value;
+    prevLux = saved.lux.previous;
+    currLux = saved.lux.value;
+    if (!saved.screenValid) {
+        return;
+    }
+
+    timeRenderer.assumeDrawn(saved.time);
+    strcpy(shownDate, saved.date);
+    tempTile.assumeShown(saved.tiles[0].value, saved.tiles[0].bg);
+    humiTile.assumeShown(saved.tiles[1].value, saved.tiles[1].bg);
+    luxTile.assumeShown(saved.tiles[2].value, saved.tiles[2].bg);
+    syncMarkShown = saved.syncMarkShown;
 }
 
 /**
- * Connects to WIFI
+ * Marks the remembered screen contents stale before drawing, so a reset
+ * halfway through a frame makes the next boot repaint everything
  */
-bool wifiConnect() {
-    // // check for the presence of the shield:
-    WiFi.mode(WIFI_STA);
-    WiFiMulti.addAP(WIFI_SSID, WIFI_PASS);
+void forgetScreen() {
+    resume.snapshot().screenValid = false;
+    resume.save();
+}
 
-    while (WiFiMulti.run() != WL_CONNECTED) {
-        tft.print(".");
-        delay(500);
+/**
+ * Records the sensor values and what is on screen in RTC memory, cheap
+ * enough to do after every render
+ */
+void rememberState() {
+    ResumeRecord::Snapshot &state = resume.snapshot();
+    state.temp = {currTemp, prevTemp};
+    state.humi = {currHumi, prevHumi};
+    state.lux = {currLux, prevLux};
+
+    strncpy(state.time, currTime, sizeof(state.time));
+    strncpy(state.date, shownDate, sizeof(state.date));
+    SensorTile *tiles[ResumeRecord::tileCount] = {&tempTile, &humiTile, &luxTile};
+    for (uint8_t i = 0; i < ResumeRecord::tileCount; i++) {
+        strncpy(state.tiles[i].value, tiles[i]->shownText(), sizeof(state.tiles[i].value));
+        state.tiles[i].bg = tiles[i]->shownColor();
     }
+    state.syncMarkShown = syncMarkShown;
+    state.screenValid = true;
+    resume.save();
+}
 
-    if (WiFi.status() == WL_CONNECTED) {
-        onWifi = true;
-        Serial.println(" CONNECTED");
+/**
+ * Task: logs how often each task ran and how late, and how long minute
+ * flips take to reach the screen
+ */
+void reportStats() {
+    scheduler.report(console);
+    console.printf("sensor events: temp %lu/%lu humi %lu/%lu lux %lu/%lu (published/samples)\n",
+                   (unsigned long) tempFilter.publishCount(), (unsigned long) tempFilter.sampleCount(),
+                   (unsigned long) humiFilter.publishCount(), (unsigned long) humiFilter.sampleCount(),
+                   (unsigned long) luxFilter.publishCount(), (unsigned long) luxFilter.sampleCount());
+    console.printf("tile redraws: temp %lu/%lu humi %lu/%lu lux %lu/%lu (drawn/skipped)\n",
+                   (unsigned long) tempTile.drawnCount(), (unsigned long) tempTile.skippedCount(),
+                   (unsigned long) humiTile.drawnCount(), (unsigned long) humiTile.skippedCount(),
+                   (unsigned long) luxTile.drawnCount(), (unsigned long) luxTile.skippedCount());
+    console.printf("minute latency: %lu updates, min %lu avg %lu max %lu us\n",
+                   (unsigned long) minuteLatency.count(), (unsigned long) minuteLatency.min(),
+                   (unsigned long) minuteLatency.avg(), (unsigned long) minuteLatency.max());
+    console.printf("date rebuilds: %lu, next at %ld\n", (unsigned long) calendar.rebuildCount(),
+                   (long) calendar.nextMidnight());
+    console.printf("boot: first frame at %lu ms, wifi connected at %lu ms\n", (unsigned long) firstFrameMs,
+                   (unsigned long) wifi.firstConnectedMs());
+    console.printf("wifi: %s, %lu attempts, %lu reconnects, %lu without scan\n", WifiLink::stateName(wifi.state()),
+                   (unsigned long) wifi.attempts(), (unsigned long) wifi.reconnects(),
+                   (unsigned long) wifi.fastConnects());
+}
+
+/**
+ * Task: keeps the WiFi link up in the background and starts NTP every
+ * time it comes up. Until then the clock runs on whatever time it has
+ */
+void wifiTick() {
+    uint32_t nextMs;
+    if (wifi.poll(&nextMs)) {
+        onWifi = wifi.state() == WifiLink::connected;
+        console.printf("wifi: %s after %lu attempts\n", WifiLink::stateName(wifi.state()),
+                       (unsigned long) wifi.attempts());
+        if (onWifi) {
+            char ip[16];
+            hw.network.localIP(ip, sizeof(ip));
+            console.printf("wifi: obtained IP %s in %lu ms%s, first connected at %lu ms\n", ip,
+                           (unsigned long) wifi.lastAttemptMs(), wifi.lastAttemptFast() ? " (cached AP)" : "",
+                           (unsigned long) wifi.firstConnectedMs());
+            getNtpTime();
+        }
+    }
+    if (!timeSynced && hw.clock.synced()) {
+        timeSynced = true;
+        console.printf("time: synced at %lu ms\n", (unsigned long) hw.clock.millis());
+        //The wall clock may have jumped, refresh the time now rather than
+        //at the next minute the old one predicted
+        nextMinuteMs = 0;
+        scheduler.schedule(timeTask, 0, true);
+        syncDirty = true;
+        scheduler.schedule(renderTask, 0);
     }
-    return onWifi;
+    scheduler.schedule(wifiTask, nextMs, true);
 }
 
 /**
@@ -248,186 +575,156 @@ bool wifiConnect() {
 bool getNtpTime() {
     bool result = false;
     if (onWifi) {
-        configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
+        hw.clock.startSync(gmtOffset_sec, daylightOffset_sec, ntpServer);
         result = true;
     } else {
-        Serial.println("getNtpTime: Not connected to wifi!");
+        console.printf("getNtpTime: Not connected to wifi!\n");
     }
     return result;
 }
 
 /**
- * Displays time string erasing the previous one
+ * Displays time string repainting only the segments that changed
  */
 void displayTime() {
-    tft.setTextSize(1);
-
-    tft.setCursor(xTime, yTime);
-    tft.setFont(&DSEG14Modern_Bold40pt7b);
-
-    int16_t x1, y1;
-    uint16_t w, h;
-
-    tft.getTextBounds("00:00", xTime, yTime, &x1, &y1, &w, &h);
-    yield();
-    tft.fillRect(x1, y1, w, h, tftBG);
-    tft.setCursor(xTime, yTime);
-    tft.setTextColor(tftTimeFG);
-    tft.println(currTime);
-    yield();
-    tft.setFont();
+    tft.profile("time");
+    timeRenderer.draw(currTime);
+    console.printf("displayTime: %u segments, pixels written %lu\n", timeRenderer.lastSegmentsPainted(),
+                   (unsigned long) timeRenderer.lastPixelsWritten());
 }
 
 /**
- * Displays date string
+ * Displays date string, overwriting the previous one in a single pass,
+ * unless it is already on screen
  */
 void displayDate() {
-    tft.setTextSize(1);
-    tft.setCursor(16, yTime + 40);
-    tft.setFont(&Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b);
+    if (strcmp(shownDate, calendar.date()) == 0) {
+        return;
+    }
+    tft.profile("date");
+    blitter.drawTextOpaque(&Droid_Sans_Mono_Nerd_Font_Complete_Mono15pt7b, xDate, yDate, calendar.date(),
+                           ILI9341_LGREEN, tftBG, dateTop, dateHeight, dateWidth);
+    strcpy(shownDate, calendar.date());
+    yield();
+}
 
-    int16_t x1, y1;
-    uint16_t w, h;
+/**
+ * Shows the sync mark while the time is not from NTP, hides it after
+ */
+void displaySyncMark() {
+    bool unsynced = !hw.clock.synced();
+    if (unsynced == syncMarkShown) {
+        return;
+    }
+    tft.profile("sync");
+    tft.fillRect(xSyncMark, ySyncMark, sizeSyncMark, sizeSyncMark, unsynced ? tftSyncMark : tftBG);
+    syncMarkShown = unsynced;
+}
 
-    tft.getTextBounds("Mon, 31 Jun 2020", 16, yTime + 40, &x1, &y1, &w, &h);
-    yield();
-    tft.fillRect(x1, y1, w, h, tftBG);
-    tft.setTextColor(ILI9341_LGREEN);
-    tft.println(currDate);
+/**
+ * Shows a formatted value on a sensor tile, which skips the redraw when
+ * text and colour are what is already on screen
+ */
+void displayTile(SensorTile &tile, const char *value, int bgColor) {
+    tft.profile(tile.label());
+    tile.show(value, bgColor);
     yield();
-    tft.setFont();
+}
 
+/**
+ * Picks the tile colour from the direction of the last change
+ */
+int trendColor(int32_t curr, int32_t prev) {
+    if (curr == prev) {
+        return ILI9341_LGREEN;
+    } else if (curr < prev) {
+        return ILI9341_LCYAN;
+    }
+    return ILI9341_LORANGE;
 }
 
+/**
+ * Displays ambient light
+ */
 void displayLux() {
-    int bgColor = 0;
-    if (currLux == prevLux) {
-        bgColor = ILI9341_LGREEN;
-    } else if (currLux < prevLux) {
-        bgColor = ILI9341_LCYAN;
+    char cLux[tileChars + 1];
+    //The only rounding of the reading, the driver truncates to 0.1 lx
+    int32_t lux = (currLux + 5) / 10;
+    if (lux > (int32_t) maxTileLux) {
+        TextWriter(cLux).integer((lux + 500) / 1000, tileChars - 1).character('k');
     } else {
-        bgColor = ILI9341_LORANGE;
+        formatFixed<tileChars>(cLux, lux, 0);
     }
-    tft.setTextColor(ILI9341_BLACK);
-    yield();
-    tft.fillRect(212, 170, 92, 60, bgColor);
-    tft.drawRect(212, 170, 92, 60, ILI9341_WHITE);
-    yield();
-    tft.setTextSize(2);
-    tft.setCursor(242, 174);
-    tft.print("LUX");
-    tft.setTextSize(3);
-    tft.setCursor(214, 200);
-    char cLux[5] = " ";
-    sprintf(cLux, "%05f", currLux);
-    tft.print(cLux);
+    displayTile(luxTile, cLux, trendColor(currLux, prevLux));
 }
 
 /**
  * Displays temperature
  */
 void displayTemp() {
-    int bgColor = 0;
-    if (currTemp == prevTemp) {
-        bgColor = ILI9341_LGREEN;
-    } else if (currTemp < prevTemp) {
-        bgColor = ILI9341_LCYAN;
-    } else {
-        bgColor = ILI9341_LORANGE;
-    }
-
-    tft.setTextColor(ILI9341_BLACK);
-    yield();
-    tft.fillRect(14, 170, 92, 60, bgColor);
-    tft.drawRect(14, 170, 92, 60, ILI9341_WHITE);
-    yield();
-    tft.setTextSize(2);
-    tft.setCursor(34, 174);
-    tft.print("TEMP");
-    tft.setTextSize(3);
-    tft.setCursor(16, 200);
-    tft.print(currTemp);
+    char cTemp[tileChars + 1];
+    formatFixed<tileChars>(cTemp, currTemp, 2);
+    displayTile(tempTile, cTemp, trendColor(currTemp, prevTemp));
 }
 
 /**
  * Displays relative humidity
  */
 void displayHumi() {
-    int bgColor = 0;
-    if (currHumi == prevHumi) {
-        bgColor = ILI9341_LGREEN;
-    } else if (currHumi < prevHumi) {
-        bgColor = ILI9341_LCYAN;
-    } else {
-        bgColor = ILI9341_LORANGE;
-    }
-    tft.setTextColor(ILI9341_BLACK);
-    yield();
-    tft.fillRect(113, 170, 92, 60, bgColor);
-    tft.drawRect(113, 170, 92, 60, ILI9341_WHITE);
-    yield();
-    tft.setTextSize(2);
-    tft.setCursor(135, 174);
-    tft.print("H.R.");
-    tft.setTextSize(3);
-    tft.setCursor(115, 200);
-    tft.print(currHumi);
+    char cHumi[tileChars + 1];
+    formatFixed<tileChars>(cHumi, currHumi, 2);
+    displayTile(humiTile, cHumi, trendColor(currHumi, prevHumi));
 }
 
 /**
- * Returns ambient light luxes
+ * Returns ambient light luxes, firing luxChanged on a meaningful change
  */
-float getCurrentLux() {
-    prevLux = currLux;
-    currLux = lightMeter.readLightLevel();
-
-    if (prevLux != currLux) {
+int32_t getCurrentLux() {
+    int32_t lux;
+    if (hw.light.readLux(&lux) && luxFilter.add(lux)) {
+        prevLux = currLux;
+        currLux = luxFilter.value();
         luxChanged();
     }
     return currLux;
 }
 
 /**
- * Returns temperature
+ * Returns temperature, firing tempChanged on a meaningful change
  */
-float getCurrentTemp() {
-    prevTemp = currTemp;
-
-    sensors_event_t event;
-    dht.temperature().getEvent(&event);
-    if (isnan(event.temperature)) {
-        Serial.println("Error reading temperature!");
+int32_t getCurrentTemp() {
+    int32_t temperature;
+    if (!hw.climate.readTemperature(&temperature)) {
+        console.printf("Error reading temperature!\n");
     } else {
-        Serial.print("Temperature: ");
-        Serial.print(event.temperature);
-        Serial.println("°C");
-        currTemp = event.temperature;
-    }
-
-    if (prevTemp != currTemp) {
-        tempChanged();
+        char text[12];
+        formatFixed(text, sizeof(text), temperature, 2);
+        console.printf("Temperature: %s°C\n", text);
+        if (tempFilter.add(temperature)) {
+            prevTemp = currTemp;
+            currTemp = tempFilter.value();
+            tempChanged();
+        }
     }
-
     return currTemp;
 }
 
 /**
- * Returns humidity
+ * Returns humidity, firing humiChanged on a meaningful change
  */
-float getCurrentHumi() {
-    prevHumi = currHumi;
-    sensors_event_t event;
-    dht.humidity().getEvent(&event);
-    if (isnan(event.relative_humidity)) {
-        Serial.println("Error reading humidity!");
+int32_t getCurrentHumi() {
+    int32_t humidity;
+    if (!hw.climate.readHumidity(&humidity)) {
+        console.printf("Error reading humidity!\n");
     } else {
-        Serial.print("Humidity: ");
-        Serial.print(event.relative_humidity);
-        Serial.println("%");
-    }
-    currHumi = event.relative_humidity;
-    if (prevHumi != currHumi) {
-        humiChanged();
+        char text[12];
+        formatFixed(text, sizeof(text), humidity, 2);
+        console.printf("Humidity: %s%%\n", text);
+        if (humiFilter.add(humidity)) {
+            prevHumi = currHumi;
+            currHumi = humiFilter.value();
+            humiChanged();
+        }
     }
     return currHumi;
 }
@@ -436,37 +733,36 @@ float getCurrentHumi() {
  * Event for change of ambient light
  */
 void luxChanged() {
-    Serial.print("luxChanged event fired! ");
-    Serial.println(currLux);
-    displayLux();
+    char text[12];
+    formatFixed(text, sizeof(text), currLux, 1);
+    console.printf("luxChanged event fired! %s\n", text);
+    luxDirty = true;
+    scheduler.schedule(renderTask, 0);
 }
 
 /**
  * Event for change of temperature
  */
 void tempChanged() {
-    Serial.print("tempChanged event fired! ");
-    displayTemp();
+    console.printf("tempChanged event fired! ");
+    tempDirty = true;
+    scheduler.schedule(renderTask, 0);
 }
 
 /**
  * Event for change of humidity
  */
 void humiChanged() {
-    Serial.println("humiChanged event fired!");
-    displayHumi();
-
+    console.printf("humiChanged event fired!\n");
+    humiDirty = true;
+    scheduler.schedule(renderTask, 0);
 }
 
 /**
- * Returns a string formatted HH:MM based on hours and minutes
+ * Writes a string formatted HH:MM based on hours and minutes into buffer
  */
-String hourMinuteToTime(int hour, int minute) {
-    String sTime;
-    char cTime[5] = " ";
-    sprintf(cTime, "%02d:%02d", hour, minute);
-    sTime = (char *) cTime;
-    return sTime;
+void hourMinuteToTime(int hour, int minute, char *buffer, size_t size) {
+    TextWriter(buffer, size).zeroPadded(hour, 2).character(':').zeroPadded(minute, 2);
 }
 
 /**
@@ -476,60 +772,42 @@ String hourMinuteToTime(int hour, int minute) {
  * Event for change of time HH:MM
  */
 void timeChanged() {
-    Serial.println("timeChanged event fired!");
-    displayTime();
+    console.printf("timeChanged event fired!\n");
+    timeDirty = true;
+    scheduler.schedule(renderTask, 0);
 }
 
 /**
  * Event for change of date weekDay, day de Month de Year
  */
 void dateChanged() {
-    Serial.println("dateChanged event fired!");
-    displayDate();
+    console.printf("dateChanged event fired!\n");
+    dateDirty = true;
+    scheduler.schedule(renderTask, 0);
 }
 
 /*
  * Returns current time in HH:MM format
  */
-String refreshTime() {
-    Serial.println("refresh time");
+const char *refreshTime() {
+    console.printf("refresh time\n");
 
     //Time
-    time_t now;
+    time_t now = hw.clock.now();
     struct tm *timeinfo;
-    time(&now);
     timeinfo = localtime(&now);
-    prevTime = currTime;
-    currTime = hourMinuteToTime(timeinfo->tm_hour, timeinfo->tm_min);
-    Serial.println(currTime);
-    if (prevTime != currTime) {
+    strcpy(prevTime, currTime);
+    hourMinuteToTime(timeinfo->tm_hour, timeinfo->tm_min, currTime, sizeof(currTime));
+    console.printf("%s\n", currTime);
+    if (strcmp(prevTime, currTime) != 0) {
         timeChanged();
-        //If time has changed, lets check if date has changed too
-        //Date
-        int wDay;
-        wDay = timeinfo->tm_wday;
-        if (wDay == 0) {
-            wDay = 7;
-        }
-        String calDate = "";
-        calDate = calDate + weekDays[wDay];
-        calDate = calDate + ", ";
-        calDate = calDate + timeinfo->tm_mday;
-        calDate = calDate + " ";
-        calDate = calDate + months[(timeinfo->tm_mon + 1)];
-        calDate = calDate + " ";
-        calDate = calDate + (timeinfo->tm_year + 1900);
-        if (calDate.length() == 21) {
-            calDate = " " + calDate;
-        }
-        prevDate = currDate;
-        currDate = calDate;
-        if (prevDate != currDate) {
+        //The date is only rebuilt once the cached day is over
+        if (calendar.update(now)) {
             dateChanged();
         }
     }
 
-    Serial.println("refresh time done");
+    console.printf("refresh time done\n");
 
     return currTime;
 }
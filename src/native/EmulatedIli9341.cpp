@@ -0,0 +1,278 @@
+#include <stdio.h>
+#include <string.h>
+#include "EmulatedIli9341.h"
+#include "NativePlatform.h"
+#include "Checksum.h"
+
+EmulatedIli9341::EmulatedIli9341(uint32_t spiHz, SimulatedClock *clock)
+        : framebuffer(), windowX(0), windowY(0), windowW(0), windowH(0), windowPos(0),
+          spiHz(spiHz), clock(clock), unchargedBits(0), total(), sectionTotals(), sectionNames(), sections(0), section(-1) {
+}
+
+/**
+ * The init sequence of Adafruit_ILI9341::begin is 22 commands and 61
+ * data bytes followed by sleep out and display on
+ */
+void EmulatedIli9341::begin() {
+    startWrite();
+    for (uint8_t i = 0; i < 24; i++) {
+        command(0);
+    }
+    data(61);
+    endWrite();
+    //MADCTL for setRotation(3)
+    startWrite();
+    command(1);
+    endWrite();
+}
+
+int16_t EmulatedIli9341::width() const {
+    return panelWidth;
+}
+
+int16_t EmulatedIli9341::height() const {
+    return panelHeight;
+}
+
+void EmulatedIli9341::startWrite() {
+    current().transactions++;
+    total.transactions++;
+}
+
+void EmulatedIli9341::endWrite() {
+}
+
+SpiStats &EmulatedIli9341::current() {
+    static SpiStats unattributed;
+    return section >= 0 ? sectionTotals[section] : unattributed;
+}
+
+/**
+ * One command byte with DC low followed by dataBytes of parameters
+ */
+void EmulatedIli9341::command(uint8_t dataBytes) {
+    current().commands++;
+    total.commands++;
+    data(1 + dataBytes);
+}
+
+/**
+ * Accounts bytes on the bus and, with a clock attached, lets the time
+ * they take on the wire pass
+ */
+void EmulatedIli9341::data(uint64_t bytes) {
+    current().bytes += bytes;
+    total.bytes += bytes;
+    if (clock != nullptr) {
+        unchargedBits += bytes * 8;
+        uint64_t us = unchargedBits * 1000000 / spiHz;
+        clock->advanceMicros(us);
+        unchargedBits -= us * spiHz / 1000000;
+    }
+}
+
+void EmulatedIli9341::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    windowX = x;
+    windowY = y;
+    windowW = w;
+    windowH = h;
+    windowPos = 0;
+
+    current().addrWindows++;
+    total.addrWindows++;
+    command(4); //CASET
+    command(4); //PASET
+    command(0); //RAMWR
+}
+
+/**
+ * Stores one pixel at the current window position and advances it,
+ * wrapping inside the window like the panel's memory write does
+ */
+void EmulatedIli9341::pushColor(uint16_t color) {
+    if (windowW == 0 || windowH == 0) {
+        return;
+    }
+    uint32_t x = windowX + windowPos % windowW;
+    uint32_t y = windowY + (windowPos / windowW) % windowH;
+    if (x < (uint32_t) panelWidth && y < (uint32_t) panelHeight) {
+        framebuffer[y * panelWidth + x] = color;
+    }
+    windowPos++;
+}
+
+void EmulatedIli9341::writePixels(const uint16_t *colors, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        pushColor(colors[i]);
+    }
+    current().pixels += len;
+    total.pixels += len;
+    data(2 * (uint64_t) len);
+}
+
+void EmulatedIli9341::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    //Clip like Adafruit_SPITFT does before touching the panel
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > panelWidth) {
+        w = panelWidth - x;
+    }
+    if (y + h > panelHeight) {
+        h = panelHeight - y;
+    }
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    setAddrWindow(x, y, w, h);
+    uint32_t len = (uint32_t) w * h;
+    for (uint32_t i = 0; i < len; i++) {
+        pushColor(color);
+    }
+    current().pixels += len;
+    total.pixels += len;
+    data(2 * (uint64_t) len);
+}
+
+void EmulatedIli9341::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    writeFillRect(x, y, w, 1, color);
+}
+
+void EmulatedIli9341::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFillRect(x, y, w, h, color);
+    endWrite();
+}
+
+void EmulatedIli9341::fillScreen(uint16_t color) {
+    fillRect(0, 0, panelWidth, panelHeight, color);
+}
+
+/**
+ * Boot screen text is not rasterized on the host, it goes to stdout
+ */
+void EmulatedIli9341::println(const char *text, uint16_t color, uint8_t size) {
+    (void) color;
+    (void) size;
+    printf("[tft] %s\n", text);
+}
+
+void EmulatedIli9341::profile(const char *name) {
+    for (uint8_t i = 0; i < sections; i++) {
+        if (strcmp(sectionNames[i], name) == 0) {
+            section = i;
+            return;
+        }
+    }
+    if (sections < maxSections) {
+        sectionNames[sections] = name;
+        section = sections++;
+    } else {
+        section = -1;
+    }
+}
+
+uint16_t EmulatedIli9341::pixel(int16_t x, int16_t y) const {
+    return framebuffer[y * panelWidth + x];
+}
+
+bool EmulatedIli9341::savePpm(const char *path) const {
+    FILE *file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", panelWidth, panelHeight);
+    for (uint32_t i = 0; i < (uint32_t) panelWidth * panelHeight; i++) {
+        uint16_t c = framebuffer[i];
+        uint8_t rgb[3] = {(uint8_t) ((c >> 11) << 3), (uint8_t) (((c >> 5) & 0x3F) << 2), (uint8_t) ((c & 0x1F) << 3)};
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * Opens a PPM written by savePpm and skips its header, nullptr when it is
+ * missing or not a 320x240 PPM
+ */
+static FILE *openPpm(const char *path, int16_t width, int16_t height) {
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    int w, h, max;
+    if (fscanf(file, "P6 %d %d %d", &w, &h, &max) != 3 || w != width || h != height || max != 255
+        || fgetc(file) == EOF) {
+        fclose(file);
+        return nullptr;
+    }
+    return file;
+}
+
+long EmulatedIli9341::comparePpm(const char *path) const {
+    FILE *file = openPpm(path, panelWidth, panelHeight);
+    if (file == nullptr) {
+        return -1;
+    }
+    long differing = 0;
+    for (uint32_t i = 0; i < (uint32_t) panelWidth * panelHeight; i++) {
+        uint8_t rgb[3];
+        if (fread(rgb, 1, sizeof(rgb), file) != sizeof(rgb)) {
+            fclose(file);
+            return -1;
+        }
+        uint16_t c = ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+        if (c != framebuffer[i]) {
+            differing++;
+        }
+    }
+    fclose(file);
+    return differing;
+}
+
+uint32_t EmulatedIli9341::checksum() const {
+    return crc32(framebuffer, sizeof(framebuffer));
+}
+
+bool EmulatedIli9341::loadPpm(const char *path) {
+    FILE *file = openPpm(path, panelWidth, panelHeight);
+    if (file == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < (uint32_t) panelWidth * panelHeight; i++) {
+        uint8_t rgb[3];
+        if (fread(rgb, 1, sizeof(rgb), file) != sizeof(rgb)) {
+            fclose(file);
+            return false;
+        }
+        framebuffer[i] = ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+    }
+    fclose(file);
+    return true;
+}
+
+double EmulatedIli9341::spiMicros(const SpiStats &traffic) const {
+    return traffic.bytes * 8 * 1000000.0 / spiHz;
+}
+
+void addStats(SpiStats &a, const SpiStats &b) {
+    a.transactions += b.transactions;
+    a.commands += b.commands;
+    a.addrWindows += b.addrWindows;
+    a.bytes += b.bytes;
+    a.pixels += b.pixels;
+}
+
+SpiStats diffStats(const SpiStats &a, const SpiStats &b) {
+    SpiStats d;
+    d.transactions = a.transactions - b.transactions;
+    d.commands = a.commands - b.commands;
+    d.addrWindows = a.addrWindows - b.addrWindows;
+    d.bytes = a.bytes - b.bytes;
+    d.pixels = a.pixels - b.pixels;
+    return d;
+}
@@ -0,0 +1,144 @@
+#ifndef EMULATED_ILI9341_H
+#define EMULATED_ILI9341_H
+
+#include "hal/Display.h"
+
+class SimulatedClock;
+
+/**
+ * Traffic an ILI9341 would have seen on the SPI bus
+ */
+struct SpiStats {
+    uint32_t transactions;
+    uint32_t commands;
+    uint32_t addrWindows;
+    uint64_t bytes;
+    uint64_t pixels;
+};
+
+/**
+ * Host stand-in for Adafruit_ILI9341: a 320x240 RGB565 framebuffer with
+ * the panel's address window semantics, which also counts what every
+ * call would cost on the wire the way Adafruit_SPITFT drives the panel
+ * (CASET, PASET and RAMWR per address window, two bytes per pixel).
+ */
+class EmulatedIli9341 : public Display {
+public:
+    static const int16_t panelWidth = 320;
+    static const int16_t panelHeight = 240;
+    static const uint8_t maxSections = 8;
+
+    explicit EmulatedIli9341(uint32_t spiHz = 40000000, SimulatedClock *clock = nullptr);
+
+    void begin() override;
+
+    int16_t width() const override;
+
+    int16_t height() const override;
+
+    void startWrite() override;
+
+    void endWrite() override;
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+    void writePixels(const uint16_t *colors, uint32_t len) override;
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void fillScreen(uint16_t color) override;
+
+    void println(const char *text, uint16_t color, uint8_t size) override;
+
+    void profile(const char *section) override;
+
+    uint16_t pixel(int16_t x, int16_t y) const;
+
+    /**
+     * The whole framebuffer, row by row
+     */
+    const uint16_t *pixels() const { return framebuffer; }
+
+    /**
+     * Writes the framebuffer as a binary PPM, returns false on I/O errors
+     */
+    bool savePpm(const char *path) const;
+
+    /**
+     * Counts the pixels that differ from a PPM written by savePpm, or
+     * returns -1 when the file is missing or not a 320x240 PPM
+     */
+    long comparePpm(const char *path) const;
+
+    /**
+     * CRC-32 of the framebuffer, a reference image that fits on a line
+     */
+    uint32_t checksum() const;
+
+    /**
+     * Replaces the framebuffer with a PPM written by savePpm, without any
+     * bus traffic, like a panel that kept its contents over a reset
+     */
+    bool loadPpm(const char *path);
+
+    /**
+     * Traffic since construction
+     */
+    const SpiStats &stats() const { return total; }
+
+    /**
+     * Number of sections seen so far, and their names and traffic
+     */
+    uint8_t sectionCount() const { return sections; }
+
+    const char *sectionName(uint8_t i) const { return sectionNames[i]; }
+
+    const SpiStats &sectionStats(uint8_t i) const { return sectionTotals[i]; }
+
+    /**
+     * Wall-clock time the given traffic takes at the configured SPI clock
+     */
+    double spiMicros(const SpiStats &traffic) const;
+
+private:
+    void pushColor(uint16_t color);
+
+    void command(uint8_t dataBytes);
+
+    void data(uint64_t bytes);
+
+    SpiStats &current();
+
+    uint16_t framebuffer[panelWidth * panelHeight];
+
+    uint16_t windowX;
+    uint16_t windowY;
+    uint16_t windowW;
+    uint16_t windowH;
+    uint32_t windowPos;
+
+    uint32_t spiHz;
+    SimulatedClock *clock;
+    uint64_t unchargedBits;
+    SpiStats total;
+    SpiStats sectionTotals[maxSections];
+    const char *sectionNames[maxSections];
+    uint8_t sections;
+    int8_t section;
+};
+
+/**
+ * Adds b to a, field by field
+ */
+void addStats(SpiStats &a, const SpiStats &b);
+
+/**
+ * Returns a minus b, field by field
+ */
+SpiStats diffStats(const SpiStats &a, const SpiStats &b);
+
+#endif //EMULATED_ILI9341_H
@@ -0,0 +1,302 @@
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "NativePlatform.h"
+
+void yield() {
+}
+
+SimulatedClimateSensor::SimulatedClimateSensor(Clock &clock, float startHours)
+        : clock(clock), startHours(startHours) {
+}
+
+float SimulatedClimateSensor::hours() const {
+    return startHours + clock.millis() / 3600000.0f;
+}
+
+void SimulatedClimateSensor::begin() {
+}
+
+void SimulatedClimateSensor::temperatureInfo(SensorInfo *info) {
+    strcpy(info->name, "SIM11");
+    info->version = 1;
+    info->sensorId = 0;
+    info->maxValue = 50;
+    info->minValue = 0;
+    info->resolution = 2;
+    info->minDelayUs = 1000000;
+}
+
+void SimulatedClimateSensor::humidityInfo(SensorInfo *info) {
+    strcpy(info->name, "SIM11");
+    info->version = 1;
+    info->sensorId = 1;
+    info->maxValue = 80;
+    info->minValue = 20;
+    info->resolution = 5;
+    info->minDelayUs = 1000000;
+}
+
+bool SimulatedClimateSensor::poll(uint32_t *nextMs) {
+    *nextMs = 1000;
+    return true;
+}
+
+bool SimulatedClimateSensor::readTemperature(int32_t *centiCelsius) {
+    //DHT11 resolution is a whole degree
+    *centiCelsius = (int32_t) roundf(22 + 3 * sinf(hours() * 0.26f)) * 100;
+    return true;
+}
+
+bool SimulatedClimateSensor::readHumidity(int32_t *centiPercent) {
+    *centiPercent = (int32_t) roundf(45 + 10 * cosf(hours() * 0.26f)) * 100;
+    return true;
+}
+
+SimulatedLightSensor::SimulatedLightSensor(Clock &clock, float startHours)
+        : clock(clock), startHours(startHours), reads(0), measuring(false) {
+}
+
+float SimulatedLightSensor::hours() const {
+    return startHours + clock.millis() / 3600000.0f;
+}
+
+void SimulatedLightSensor::begin() {
+}
+
+bool SimulatedLightSensor::poll(uint32_t *nextMs) {
+    measuring = !measuring;
+    *nextMs = 120;
+    return !measuring;
+}
+
+bool SimulatedLightSensor::readLux(int32_t *deciLux) {
+    //BH1750 high res mode 2 reports in 0.5 lx steps and jitters by a step or two
+    float level = 300 + 250 * sinf(hours() * 0.26f);
+    int jitter = (int) ((reads++ * 2654435761u) >> 30) - 2;
+    *deciLux = (int32_t) roundf(level * 2 + jitter) * 5;
+    return true;
+}
+
+SimulatedClock::SimulatedClock(time_t start, bool wallClockSet)
+        : start(start), elapsedUs(0), wallOffsetMs(wallClockSet ? 0 : -(int64_t) start * 1000), ntpSynced(false) {
+}
+
+int64_t SimulatedClock::trueEpochMs() {
+    return (int64_t) start * 1000 + (int64_t) (elapsedUs / 1000);
+}
+
+time_t SimulatedClock::now() {
+    return (time_t) (epochMs() / 1000);
+}
+
+int64_t SimulatedClock::epochMs() {
+    return trueEpochMs() + wallOffsetMs;
+}
+
+uint32_t SimulatedClock::millis() {
+    return (uint32_t) (elapsedUs / 1000);
+}
+
+uint32_t SimulatedClock::micros() {
+    return (uint32_t) elapsedUs;
+}
+
+void SimulatedClock::delay(uint32_t ms) {
+    advanceMicros((uint64_t) ms * 1000);
+}
+
+void SimulatedClock::advanceMicros(uint64_t us) {
+    elapsedUs += us;
+}
+
+void SimulatedClock::restart(time_t start, bool wallClockSet) {
+    this->start = start;
+    elapsedUs = 0;
+    wallOffsetMs = wallClockSet ? 0 : -(int64_t) start * 1000;
+    ntpSynced = false;
+}
+
+uint32_t SimulatedClock::rtcMillis() {
+    return (uint32_t) trueEpochMs();
+}
+
+void SimulatedClock::setEpochMs(int64_t ms) {
+    wallOffsetMs = ms - trueEpochMs();
+}
+
+void SimulatedClock::setTimezone(long gmtOffsetSec, int daylightOffsetSec) {
+    //Same fixed offset configTime would apply, expressed as a POSIX TZ
+    char tz[32];
+    long offset = gmtOffsetSec + daylightOffsetSec;
+    snprintf(tz, sizeof(tz), "UTC%c%ld:%02ld", offset > 0 ? '-' : '+', labs(offset) / 3600, labs(offset) % 3600 / 60);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+void SimulatedClock::startSync(long gmtOffsetSec, int daylightOffsetSec, const char *server) {
+    (void) server;
+    setTimezone(gmtOffsetSec, daylightOffsetSec);
+    //NTP answers at once with the true time
+    wallOffsetMs = 0;
+    ntpSynced = true;
+}
+
+bool SimulatedClock::synced() {
+    return ntpSynced;
+}
+
+static const uint8_t simulatedBssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+LoopbackNetwork::LoopbackNetwork(Clock &clock, uint32_t downMs, uint8_t channel, uint32_t leaseSeconds)
+        : clock(clock), downMs(downMs), channel(channel), leaseSeconds(leaseSeconds), attemptStart(0), attemptMs(0),
+          attempting(false) {
+}
+
+void LoopbackNetwork::begin(const char *ssid, const char *pass) {
+    (void) ssid;
+    (void) pass;
+}
+
+bool LoopbackNetwork::sameAccessPoint(const LinkHint *hint) const {
+    return hint->channel == channel && memcmp(hint->bssid, simulatedBssid, sizeof(simulatedBssid)) == 0;
+}
+
+void LoopbackNetwork::connect(const LinkHint *hint) {
+    attemptStart = clock.millis();
+    attempting = hint == nullptr || sameAccessPoint(hint);
+    attemptMs = hint == nullptr ? scanMs : directMs;
+}
+
+void LoopbackNetwork::disconnect() {
+    attempting = false;
+}
+
+bool LoopbackNetwork::connected() {
+    uint32_t now = clock.millis();
+    return attempting && now >= downMs && now - attemptStart >= attemptMs;
+}
+
+bool LoopbackNetwork::linkHint(LinkHint *hint) {
+    if (!connected()) {
+        return false;
+    }
+    memcpy(hint->bssid, simulatedBssid, sizeof(simulatedBssid));
+    hint->channel = channel;
+    hint->ip = 0x0100007F;
+    hint->gateway = 0x0100007F;
+    hint->subnet = 0x000000FF;
+    hint->dns = 0x0100007F;
+    hint->leaseSeconds = leaseSeconds;
+    return true;
+}
+
+void LoopbackNetwork::localIP(char *buffer, size_t size) {
+    snprintf(buffer, size, "127.0.0.1");
+}
+
+FileStorage::FileStorage(const char *path) : path(path) {
+}
+
+bool FileStorage::read(void *data, size_t size) {
+    FILE *file = path != nullptr ? fopen(path, "rb") : nullptr;
+    if (file == nullptr) {
+        return false;
+    }
+    bool complete = fread(data, 1, size, file) == size;
+    fclose(file);
+    return complete;
+}
+
+bool FileStorage::write(const void *data, size_t size) {
+    FILE *file = path != nullptr ? fopen(path, "wb") : nullptr;
+    if (file == nullptr) {
+        return false;
+    }
+    bool complete = fwrite(data, 1, size, file) == size;
+    return fclose(file) == 0 && complete;
+}
+
+StdoutConsole::StdoutConsole() : quiet(false) {
+}
+
+void StdoutConsole::begin(unsigned long baud) {
+    (void) baud;
+}
+
+void StdoutConsole::printf(const char *format, ...) {
+    if (quiet) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+/**
+ * Virtual time starts at CLOCK_EPOCH when set, so runs are reproducible.
+ * With CLOCK_UNSYNCED the wall clock starts at the epoch until NTP
+ */
+SimulatedClock &simulatedClock() {
+    static const char *epoch = getenv("CLOCK_EPOCH");
+    static SimulatedClock clock(epoch != nullptr ? (time_t) atol(epoch) : time(nullptr),
+                                getenv("CLOCK_UNSYNCED") == nullptr);
+    return clock;
+}
+
+/**
+ * SENSOR_HOURS starts the simulated sensors that far into their curves
+ */
+static float sensorStartHours() {
+    const char *hours = getenv("SENSOR_HOURS");
+    return hours != nullptr ? (float) atof(hours) : 0;
+}
+
+SimulatedClimateSensor &simulatedClimate() {
+    static SimulatedClimateSensor climate(simulatedClock(), sensorStartHours());
+    return climate;
+}
+
+SimulatedLightSensor &simulatedLight() {
+    static SimulatedLightSensor light(simulatedClock(), sensorStartHours());
+    return light;
+}
+
+StdoutConsole &stdoutConsole() {
+    static StdoutConsole console;
+    return console;
+}
+
+/**
+ * The panel SPI clock defaults to the 40 MHz Adafruit_ILI9341 uses on the
+ * ESP8266 and can be overridden with SPI_HZ. Bus time is charged to the
+ * virtual clock, so drawing takes as long as it would on the device
+ */
+EmulatedIli9341 &emulatedDisplay() {
+    static const char *hz = getenv("SPI_HZ");
+    static EmulatedIli9341 display(hz != nullptr ? (uint32_t) atol(hz) : 40000000, &simulatedClock());
+    return display;
+}
+
+Platform &platform() {
+    //WIFI_DOWN_MS keeps the access point unreachable for that long after boot
+    static const char *down = getenv("WIFI_DOWN_MS");
+    //WIFI_CHANNEL moves the access point, invalidating a stored hint
+    static const char *channel = getenv("WIFI_CHANNEL");
+    //WIFI_LEASE_S is the DHCP lease length, after half of it the stored
+    //hint is not used anymore
+    static const char *lease = getenv("WIFI_LEASE_S");
+    static LoopbackNetwork network(simulatedClock(), down != nullptr ? (uint32_t) atol(down) : 0,
+                                   channel != nullptr ? (uint8_t) atoi(channel) : 6,
+                                   lease != nullptr ? (uint32_t) atol(lease) : 86400);
+    //FLASH_FILE and RTC_FILE keep what the device has in flash and RTC
+    //memory between runs
+    static FileStorage flash(getenv("FLASH_FILE"));
+    static FileStorage rtc(getenv("RTC_FILE"));
+    static Platform instance = {emulatedDisplay(), simulatedClimate(), simulatedLight(), simulatedClock(), network,
+                                flash, rtc, stdoutConsole()};
+    return instance;
+}
@@ -0,0 +1,192 @@
+#ifndef NATIVE_PLATFORM_H
+#define NATIVE_PLATFORM_H
+
+#include "hal/Platform.h"
+#include "EmulatedIli9341.h"
+
+/**
+ * Deterministic temperature and humidity that drift slowly over time,
+ * starting startHours into their curve
+ */
+class SimulatedClimateSensor : public ClimateSensor {
+public:
+    SimulatedClimateSensor(Clock &clock, float startHours);
+
+    void begin() override;
+
+    void temperatureInfo(SensorInfo *info) override;
+
+    void humidityInfo(SensorInfo *info) override;
+
+    bool poll(uint32_t *nextMs) override;
+
+    bool readTemperature(int32_t *centiCelsius) override;
+
+    bool readHumidity(int32_t *centiPercent) override;
+
+    void setStartHours(float hours) { startHours = hours; }
+
+private:
+    float hours() const;
+
+    Clock &clock;
+    float startHours;
+};
+
+/**
+ * Deterministic ambient light following a slow daylight curve with jitter,
+ * starting startHours into it and taking the 120 ms a BH1750 high
+ * resolution measurement takes
+ */
+class SimulatedLightSensor : public LightSensor {
+public:
+    SimulatedLightSensor(Clock &clock, float startHours);
+
+    void begin() override;
+
+    bool poll(uint32_t *nextMs) override;
+
+    bool readLux(int32_t *deciLux) override;
+
+    void setStartHours(float hours) { startHours = hours; }
+
+private:
+    float hours() const;
+
+    Clock &clock;
+    float startHours;
+    uint32_t reads;
+    bool measuring;
+};
+
+/**
+ * Virtual time: delay() advances the clock instantly, so a day of
+ * loop() iterations runs in well under a second.
+ *
+ * The wall clock can start unsynced at the epoch like the device's does
+ * until NTP answers, which startSync() then does at once. The RTC
+ * counter follows the true time, as if it had kept running since an
+ * earlier run.
+ */
+class SimulatedClock : public Clock {
+public:
+    SimulatedClock(time_t start, bool wallClockSet);
+
+    time_t now() override;
+
+    int64_t epochMs() override;
+
+    uint32_t millis() override;
+
+    uint32_t micros() override;
+
+    void delay(uint32_t ms) override;
+
+    uint32_t rtcMillis() override;
+
+    void setEpochMs(int64_t ms) override;
+
+    void setTimezone(long gmtOffsetSec, int daylightOffsetSec) override;
+
+    void startSync(long gmtOffsetSec, int daylightOffsetSec, const char *server) override;
+
+    bool synced() override;
+
+    /**
+     * Moves virtual time forward without the caller sleeping
+     */
+    void advanceMicros(uint64_t us);
+
+    /**
+     * Starts virtual time over at start, like constructing the clock, so
+     * a test can pick its epoch before setup()
+     */
+    void restart(time_t start, bool wallClockSet);
+
+private:
+    int64_t trueEpochMs();
+
+    time_t start;
+    uint64_t elapsedUs;
+    int64_t wallOffsetMs;
+    bool ntpSynced;
+};
+
+/**
+ * Network with one simulated access point. A scan associates after
+ * scanMs, a hint naming the AP's BSSID and channel after directMs, any
+ * other hint never. Nothing connects during the first downMs of virtual
+ * time, to exercise the reconnect logic
+ */
+class LoopbackNetwork : public Network {
+public:
+    static const uint32_t scanMs = 1500;
+    static const uint32_t directMs = 300;
+
+    LoopbackNetwork(Clock &clock, uint32_t downMs, uint8_t channel, uint32_t leaseSeconds);
+
+    void begin(const char *ssid, const char *pass) override;
+
+    void connect(const LinkHint *hint) override;
+
+    void disconnect() override;
+
+    bool connected() override;
+
+    bool linkHint(LinkHint *hint) override;
+
+    void localIP(char *buffer, size_t size) override;
+
+private:
+    bool sameAccessPoint(const LinkHint *hint) const;
+
+    Clock &clock;
+    uint32_t downMs;
+    uint8_t channel;
+    uint32_t leaseSeconds;
+    uint32_t attemptStart;
+    uint32_t attemptMs;
+    bool attempting;
+};
+
+/**
+ * Storage in a host file, so state carries over between runs. Without a
+ * path nothing is kept
+ */
+class FileStorage : public Storage {
+public:
+    explicit FileStorage(const char *path);
+
+    bool read(void *data, size_t size) override;
+
+    bool write(const void *data, size_t size) override;
+
+private:
+    const char *path;
+};
+
+/**
+ * Console writing to stdout, silenced when quiet is set
+ */
+class StdoutConsole : public Console {
+public:
+    StdoutConsole();
+
+    void begin(unsigned long baud) override;
+
+    void printf(const char *format, ...) override;
+
+    bool quiet;
+};
+
+EmulatedIli9341 &emulatedDisplay();
+
+SimulatedClock &simulatedClock();
+
+SimulatedClimateSensor &simulatedClimate();
+
+SimulatedLightSensor &simulatedLight();
+
+StdoutConsole &stdoutConsole();
+
+#endif //NATIVE_PLATFORM_H
@@ -0,0 +1,435 @@
+//PIO builds the project sources into the unit tests, which bring their own main()
+#ifndef UNIT_TEST
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "NativePlatform.h"
+#include "Format.h"
+#include "GlyphBlitter.h"
+#include "RleFont.h"
+#include <Fonts/DSEG14Modern_Bold40pt7bSubset.h>
+#include <Fonts/DSEG14Modern_Bold40pt7bSubsetRle.h>
+
+void setup();
+
+void loop();
+
+/**
+ * Prints one line of SPI traffic with its estimated bus time
+ */
+static void printTraffic(const char *name, const SpiStats &traffic) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    printf("%-8s %8u tx %8u cmd %8u win %10llu px %10llu B %10.1f us\n", name,
+           traffic.transactions, traffic.commands, traffic.addrWindows,
+           (unsigned long long) traffic.pixels, (unsigned long long) traffic.bytes, display.spiMicros(traffic));
+}
+
+/**
+ * Saves the current screen as dumpDir/frame-NNNN.ppm
+ */
+static void dumpFrame(long frame, const char *dumpDir) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/frame-%04ld.ppm", dumpDir, frame);
+    if (!emulatedDisplay().savePpm(path)) {
+        printf("frame %ld: cannot write %s\n", frame, path);
+    }
+}
+
+/**
+ * Counts the pixels that differ between the screen and previous, then
+ * copies the screen into previous
+ */
+static long changedPixels(uint16_t *previous) {
+    const uint16_t *current = emulatedDisplay().pixels();
+    long changed = 0;
+    for (uint32_t i = 0; i < (uint32_t) EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight; i++) {
+        if (current[i] != previous[i]) {
+            changed++;
+            previous[i] = current[i];
+        }
+    }
+    return changed;
+}
+
+/**
+ * Characters of the DSEG14 subset the font benchmark draws, plain and
+ * run-length coded (tools/fontsubset.py)
+ */
+constexpr char benchCharset[] = "0123456789:"; //font-subset DSEG14Modern_Bold40pt7b rle
+
+/**
+ * Draws every glyph of the time font rounds times, opaquely at the
+ * origin, from the plain bitmaps or the run-length coded ones. Returns the
+ * real time it took in microseconds and adds the pixels written to pixels
+ */
+static long drawTimeGlyphs(bool rle, long rounds, uint64_t *pixels) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    GlyphBlitter blitter(display);
+    int16_t top;
+    uint16_t height;
+    GlyphBlitter::fontExtent(&DSEG14Modern_Bold40pt7bSubset, &top, &height);
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    for (long i = 0; i < rounds; i++) {
+        for (char c = '0'; c <= ':'; c++) {
+            if (rle) {
+                blitter.drawCharOpaque(&DSEG14Modern_Bold40pt7bSubsetRle, 0, -top, c, 0xFFFF, 0, top, height);
+            } else {
+                blitter.drawCharOpaque(&DSEG14Modern_Bold40pt7bSubset, 0, -top, c, 0xFFFF, 0, top, height);
+            }
+        }
+        *pixels += blitter.pixelCount();
+        blitter.resetStats();
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+}
+
+/**
+ * Draws text the way Adafruit_GFX::drawChar does with a custom font: one
+ * writePixel, a 1x1 address window and its pixel, per set bit. Returns
+ * the number of writePixel calls
+ */
+static uint32_t drawTextPerPixel(const GFXfont *font, int16_t x, int16_t y, const char *text, uint16_t color) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    uint32_t calls = 0;
+    display.startWrite();
+    for (; *text != '\0'; text++) {
+        const GFXglyph *glyph = GlyphBlitter::glyphFor(font, *text);
+        if (glyph == nullptr) {
+            continue;
+        }
+        const uint8_t *bitmap = font->bitmap + glyph->bitmapOffset;
+        uint8_t bits = 0;
+        uint16_t bit = 0;
+        for (uint8_t yy = 0; yy < glyph->height; yy++) {
+            for (uint8_t xx = 0; xx < glyph->width; xx++) {
+                if (!(bit & 7)) {
+                    bits = bitmap[bit / 8];
+                }
+                bit++;
+                if (bits & 0x80) {
+                    display.setAddrWindow(x + glyph->xOffset + xx, y + glyph->yOffset + yy, 1, 1);
+                    display.writePixels(&color, 1);
+                    calls++;
+                }
+                bits <<= 1;
+            }
+        }
+        x += glyph->xAdvance;
+    }
+    display.endWrite();
+    return calls;
+}
+
+/**
+ * Draws the time transparently through the blitter's runs and through
+ * per pixel writes like the stock drawChar, checking both leave the same
+ * image and printing the write calls and SPI traffic each takes
+ */
+static bool transparentBenchmark() {
+    EmulatedIli9341 &display = emulatedDisplay();
+    GlyphBlitter blitter(display);
+    int16_t top;
+    uint16_t height;
+    GlyphBlitter::fontExtent(&DSEG14Modern_Bold40pt7bSubset, &top, &height);
+    static const char text[] = "12:34";
+    static uint16_t stock[EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight];
+
+    display.fillScreen(0x0000);
+    SpiStats before = display.stats();
+    uint32_t writePixels = drawTextPerPixel(&DSEG14Modern_Bold40pt7bSubset, 0, -top, text, 0xFFFF);
+    SpiStats perPixel = diffStats(display.stats(), before);
+    memcpy(stock, display.pixels(), sizeof(stock));
+
+    display.fillScreen(0x0000);
+    blitter.resetStats();
+    before = display.stats();
+    blitter.drawText(&DSEG14Modern_Bold40pt7bSubset, 0, -top, text, 0xFFFF);
+    SpiStats runs = diffStats(display.stats(), before);
+    bool identical = memcmp(stock, display.pixels(), sizeof(stock)) == 0;
+
+    printf("transparent \"%s\": %s, %u pixels\n", text, identical ? "identical" : "DIFFERENT", blitter.pixelCount());
+    printf("  writePixel: %8u calls %10llu B %10.1f us\n", writePixels, (unsigned long long) perPixel.bytes,
+           display.spiMicros(perPixel));
+    printf("  runs:       %8u calls %10llu B %10.1f us\n", blitter.runCount(), (unsigned long long) runs.bytes,
+           display.spiMicros(runs));
+    return identical && writePixels == blitter.pixelCount();
+}
+
+/**
+ * Compares the run-length coded time font against the plain GFXfont it
+ * was made from: flash size, identical output and decode+draw speed, and
+ * transparent run drawing against per pixel writes
+ */
+static int fontBenchmark(long rounds) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    display.begin();
+    GlyphBlitter blitter(display);
+    int16_t top;
+    uint16_t height;
+    GlyphBlitter::fontExtent(&DSEG14Modern_Bold40pt7bSubset, &top, &height);
+
+    //Each glyph is drawn on a screen cleared to a colour neither draw
+    //uses, so a pixel one of them leaves out cannot match by chance
+    const uint16_t unwritten = 0xF81F;
+    bool identical = true;
+    static uint16_t plain[EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight];
+    for (char c = '0'; c <= ':'; c++) {
+        display.fillScreen(unwritten);
+        blitter.drawCharOpaque(&DSEG14Modern_Bold40pt7bSubset, 0, -top, c, 0xFFFF, 0, top, height);
+        memcpy(plain, display.pixels(), sizeof(plain));
+        display.fillScreen(unwritten);
+        blitter.drawCharOpaque(&DSEG14Modern_Bold40pt7bSubsetRle, 0, -top, c, 0xFFFF, 0, top, height);
+        identical &= memcmp(plain, display.pixels(), sizeof(plain)) == 0;
+    }
+
+    size_t bitmapBytes = sizeof(DSEG14Modern_Bold40pt7bSubsetBitmaps);
+    size_t runBytes = sizeof(DSEG14Modern_Bold40pt7bSubsetRleRuns);
+    printf("time font bitmaps: %zu bytes plain, %zu bytes run-length coded (%.2fx)\n", bitmapBytes, runBytes,
+           (double) bitmapBytes / runBytes);
+    printf("decoded glyphs: %s\n", identical ? "identical" : "DIFFERENT");
+
+    uint64_t plainPixels = 0;
+    uint64_t rlePixels = 0;
+    long plainUs = drawTimeGlyphs(false, rounds, &plainPixels);
+    long rleUs = drawTimeGlyphs(true, rounds, &rlePixels);
+    printf("decode+draw plain: %ld us, %.1f Mpx/s\n", plainUs, plainUs > 0 ? (double) plainPixels / plainUs : 0.0);
+    printf("decode+draw rle:   %ld us, %.1f Mpx/s\n", rleUs, rleUs > 0 ? (double) rlePixels / rleUs : 0.0);
+    identical &= transparentBenchmark();
+    return identical ? 0 : 1;
+}
+
+/**
+ * Readings the format benchmark converts: DHT integral and tenths bytes
+ * for temperature (sign in bit 7) and humidity, and a BH1750 count
+ */
+struct RawReading {
+    uint8_t temperature[2];
+    uint8_t humidity[2];
+    uint16_t count;
+};
+
+static const int rawReadingCount = 256;
+
+/**
+ * Turns the readings into tile text rounds times, either the way the
+ * clock does, integer conversion and formatFixed, or through floats and
+ * snprintf("%5.2f") like it used to. Returns the real time it took in
+ * microseconds and folds the text into sink, so none of it is optimised
+ * away. With texts the output of the first round is kept there, three
+ * fields per reading
+ */
+static long formatReadings(bool fixed, long rounds, const RawReading *readings, uint32_t *sink,
+                           char (*texts)[8] = nullptr) {
+    //High resolution mode 2 at the default MTreg, as in Bh1750LightSensor
+    const uint32_t luxDivisor = 3UL * 69 * 2;
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    for (long round = 0; round < rounds; round++) {
+        for (int i = 0; i < rawReadingCount; i++) {
+            const RawReading &raw = readings[i];
+            char text[3][8];
+            if (fixed) {
+                int32_t temperature = (raw.temperature[0] & 0x7F) * 100 + raw.temperature[1] * 10;
+                if (raw.temperature[0] & 0x80) {
+                    temperature = -temperature;
+                }
+                int32_t humidity = raw.humidity[0] * 100 + raw.humidity[1] * 10;
+                int32_t deciLux = (int32_t) (raw.count * 25UL * 69 / luxDivisor);
+                formatFixed(text[0], sizeof(text[0]), temperature, 2, 5);
+                formatFixed(text[1], sizeof(text[1]), humidity, 2, 5);
+                formatFixed(text[2], sizeof(text[2]), (deciLux + 5) / 10, 0, 5);
+            } else {
+                float temperature = (raw.temperature[0] & 0x7F) + raw.temperature[1] * 0.1f;
+                if (raw.temperature[0] & 0x80) {
+                    //Adding zero turns -0 into 0
+                    temperature = -temperature + 0.0f;
+                }
+                float humidity = raw.humidity[0] + raw.humidity[1] * 0.1f;
+                //count / 2.4 as count * 5 / 12.0 comes out exact on half
+                //lux, which are rounded up like the tiles do; %.0f alone
+                //would round them to even
+                double lux = floor(raw.count * 5 / 12.0 + 0.5);
+                snprintf(text[0], sizeof(text[0]), "%5.2f", temperature);
+                snprintf(text[1], sizeof(text[1]), "%5.2f", humidity);
+                snprintf(text[2], sizeof(text[2]), "%5.0f", lux);
+            }
+            for (int field = 0; field < 3; field++) {
+                *sink += text[field][0] + text[field][4];
+                if (texts != nullptr && round == 0) {
+                    memcpy(texts[i * 3 + field], text[field], sizeof(text[field]));
+                }
+            }
+        }
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+}
+
+/**
+ * Times the integer sensor path, conversion and formatFixed, against
+ * the float one with snprintf on the same readings. Both have to produce
+ * the same text for every reading, the exit status is 1 where they do not
+ */
+static int formatBenchmark(long rounds) {
+    static RawReading readings[rawReadingCount];
+    for (int i = 0; i < rawReadingCount; i++) {
+        readings[i].temperature[0] = (uint8_t) ((i % 50) | (i % 7 == 0 ? 0x80 : 0));
+        readings[i].temperature[1] = (uint8_t) (i % 10);
+        readings[i].humidity[0] = (uint8_t) (20 + i % 70);
+        readings[i].humidity[1] = (uint8_t) (i * 3 % 10);
+        readings[i].count = (uint16_t) (i * 257);
+    }
+
+    static char fixedTexts[rawReadingCount * 3][8];
+    static char floatTexts[rawReadingCount * 3][8];
+    uint32_t sink = 0;
+    formatReadings(true, 1, readings, &sink, fixedTexts);
+    formatReadings(false, 1, readings, &sink, floatTexts);
+    static const char *fieldNames[3] = {"temperature", "humidity", "lux"};
+    bool identical = true;
+    for (int field = 0; field < 3; field++) {
+        int differing = 0;
+        int example = -1;
+        for (int i = field; i < rawReadingCount * 3; i += 3) {
+            if (strcmp(fixedTexts[i], floatTexts[i]) != 0) {
+                differing++;
+                example = example < 0 ? i : example;
+            }
+        }
+        printf("%-11s text differs from snprintf for %d of %d readings", fieldNames[field], differing,
+               rawReadingCount);
+        if (example >= 0) {
+            printf(", e.g. \"%s\" and \"%s\"", fixedTexts[example], floatTexts[example]);
+            identical = false;
+        }
+        printf("\n");
+    }
+
+    long fixedUs = formatReadings(true, rounds, readings, &sink);
+    long floatUs = formatReadings(false, rounds, readings, &sink);
+    double fields = 3.0 * rawReadingCount * rounds;
+    printf("integer + formatFixed: %ld us, %.1f ns/field\n", fixedUs, fields > 0 ? fixedUs * 1000.0 / fields : 0.0);
+    printf("float + snprintf:      %ld us, %.1f ns/field\n", floatUs, fields > 0 ? floatUs * 1000.0 / fields : 0.0);
+    printf("(checksum %u)\n", sink);
+    return identical ? 0 : 1;
+}
+
+/**
+ * Host entry point: runs setup() and then loop() the given number of
+ * times (default 60) against the emulated panel and simulated sensors.
+ * Reports the real time the clock logic took and, per frame (one loop()
+ * iteration) and per drawing section, the SPI traffic the panel would
+ * have received, how long it takes on the bus and how many pixels
+ * actually changed.
+ *
+ * With -d every frame that changed the screen is saved as a PPM, to look
+ * at. The rendering is checked against reference frames by the unit
+ * tests in test/test_render.
+ *
+ * With -f it only benchmarks the run-length coded time font against the
+ * plain one, drawing every glyph iterations times, and the transparent
+ * run drawing against per pixel writes. With -p it only
+ * benchmarks the integer sensor conversion and formatFixed against floats
+ * and snprintf, iterations rounds over a set of readings.
+ *
+ * PANEL_FILE names a PPM the panel starts from, when it exists, and is
+ * left in at the end. Together with RTC_FILE consecutive runs then act
+ * like soft resets, where RTC memory and the panel keep their contents.
+ *
+ * Usage: program [iterations] [-q] [-d dumpDir] [-f] [-p]
+ */
+int main(int argc, char **argv) {
+    long iterations = 60;
+    const char *dumpDir = nullptr;
+    bool fonts = false;
+    bool formats = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-q") == 0) {
+            stdoutConsole().quiet = true;
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            dumpDir = argv[++i];
+        } else if (strcmp(argv[i], "-f") == 0) {
+            fonts = true;
+        } else if (strcmp(argv[i], "-p") == 0) {
+            formats = true;
+        } else {
+            iterations = atol(argv[i]);
+        }
+    }
+    if (fonts) {
+        return fontBenchmark(iterations);
+    }
+    if (formats) {
+        return formatBenchmark(iterations);
+    }
+    EmulatedIli9341 &display = emulatedDisplay();
+    static uint16_t previous[EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight];
+    long changedTotal = 0;
+    long changedMax = 0;
+
+    const char *panelFile = getenv("PANEL_FILE");
+    if (panelFile != nullptr && display.loadPpm(panelFile)) {
+        memcpy(previous, display.pixels(), sizeof(previous));
+    }
+
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    setup();
+    std::chrono::steady_clock::time_point booted = std::chrono::steady_clock::now();
+    SpiStats bootTraffic = display.stats();
+    long bootChanged = changedPixels(previous);
+    if (dumpDir != nullptr) {
+        dumpFrame(0, dumpDir);
+    }
+
+    SpiStats frameTotal = SpiStats();
+    double frameMaxUs = 0;
+    long drawnFrames = 0;
+    for (long i = 0; i < iterations; i++) {
+        SpiStats before = display.stats();
+        loop();
+        SpiStats frame = diffStats(display.stats(), before);
+        if (frame.bytes > 0) {
+            drawnFrames++;
+            addStats(frameTotal, frame);
+            double us = display.spiMicros(frame);
+            if (us > frameMaxUs) {
+                frameMaxUs = us;
+            }
+        }
+        long changed = changedPixels(previous);
+        if (changed > 0) {
+            changedTotal += changed;
+            if (changed > changedMax) {
+                changedMax = changed;
+            }
+            if (dumpDir != nullptr) {
+                dumpFrame(i + 1, dumpDir);
+            }
+        }
+    }
+    std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+    long setupUs = std::chrono::duration_cast<std::chrono::microseconds>(booted - started).count();
+    long loopUs = std::chrono::duration_cast<std::chrono::microseconds>(finished - booted).count();
+    printf("setup: %ld us, %ld pixels changed\n", setupUs, bootChanged);
+    printf("loop: %ld iterations, %ld us, %.2f us/iteration\n", iterations, loopUs,
+           iterations > 0 ? (double) loopUs / iterations : 0.0);
+
+    printf("\nSPI traffic\n");
+    printTraffic("setup", bootTraffic);
+    printTraffic("frames", frameTotal);
+    for (uint8_t i = 0; i < display.sectionCount(); i++) {
+        printTraffic(display.sectionName(i), display.sectionStats(i));
+    }
+    printf("frames drawn: %ld of %ld, SPI time per drawn frame avg %.1f us max %.1f us\n", drawnFrames, iterations,
+           drawnFrames > 0 ? display.spiMicros(frameTotal) / drawnFrames : 0.0, frameMaxUs);
+    printf("pixels changed: %ld total, %ld max per frame, %llu written (%.1f%% useful)\n", changedTotal, changedMax,
+           (unsigned long long) frameTotal.pixels, frameTotal.pixels > 0 ? 100.0 * changedTotal / frameTotal.pixels : 0.0);
+    if (panelFile != nullptr && !display.savePpm(panelFile)) {
+        printf("could not save the panel to %s\n", panelFile);
+    }
+    return 0;
+}
+
+#endif //UNIT_TEST
@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#include <unity.h>
+#include "native/NativePlatform.h"
+
+void setup();
+
+void loop();
+
+/**
+ * A fixed set of inputs the clock is run from: the wall clock it starts
+ * at, how far into their curves the simulated sensors start and whether
+ * the clock is set before NTP answers
+ */
+struct RenderCase {
+    const char *name;
+    time_t epoch;
+    float sensorHours;
+    bool wallClockSet;
+};
+
+static const RenderCase cases[] = {
+        {"boot",      1602900000, 0,  true},
+        {"hour-flip", 1602903540, 6,  true},
+        {"midnight",  1602885540, 12, true},
+        {"unsynced",  1602900000, 18, false},
+};
+
+static const long iterations = 600;
+
+/**
+ * Checksum of a reference frame, from a frames.crc line
+ */
+struct FrameSum {
+    long frame;
+    uint32_t crc;
+};
+
+/**
+ * Directory of this file, which holds reference/<case>/frames.crc
+ */
+static void caseDir(const RenderCase &renderCase, char *path, size_t size) {
+    const char *slash = strrchr(__FILE__, '/');
+    int length = slash != nullptr ? (int) (slash - __FILE__) : 1;
+    snprintf(path, size, "%.*s/reference/%s", length, slash != nullptr ? __FILE__ : ".", renderCase.name);
+}
+
+static std::vector<FrameSum> loadSums(const char *dir) {
+    std::vector<FrameSum> sums;
+    char path[300];
+    snprintf(path, sizeof(path), "%s/frames.crc", dir);
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+        return sums;
+    }
+    FrameSum sum = FrameSum();
+    unsigned int crc;
+    while (fscanf(file, " frame-%ld.ppm %x", &sum.frame, &crc) == 2) {
+        sum.crc = crc;
+        sums.push_back(sum);
+    }
+    fclose(file);
+    return sums;
+}
+
+/**
+ * Compares the screen with the next reference frame. A mismatching
+ * screen is saved as frame-NNNN.actual.ppm next to the references, to be
+ * looked at, and the first mismatch fails the case.
+ */
+static bool checkFrame(long frame, const char *dir, const std::vector<FrameSum> &sums, size_t &next) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    uint32_t crc = display.checksum();
+    if (next < sums.size() && sums[next].frame == frame && sums[next].crc == crc) {
+        next++;
+        return true;
+    }
+    char path[300];
+    snprintf(path, sizeof(path), "%s/frame-%04ld.actual.ppm", dir, frame);
+    display.savePpm(path);
+    if (next < sums.size()) {
+        printf("frame %ld (%08x), reference frame %ld (%08x), saved %s\n", frame, crc, sums[next].frame,
+               sums[next].crc, path);
+    } else {
+        printf("frame %ld (%08x) is not in the references, saved %s\n", frame, crc, path);
+    }
+    return false;
+}
+
+/**
+ * Runs the clock for one case and checks every frame that changed the
+ * screen. With UPDATE_REFERENCES set it writes frames.crc instead, after
+ * an intended rendering change, to be reviewed like code. setup() runs
+ * only once per process, so each case runs here in its own child.
+ */
+static int runCase(const RenderCase &renderCase) {
+    simulatedClock().restart(renderCase.epoch, renderCase.wallClockSet);
+    simulatedClimate().setStartHours(renderCase.sensorHours);
+    simulatedLight().setStartHours(renderCase.sensorHours);
+    stdoutConsole().quiet = true;
+
+    char dir[256];
+    caseDir(renderCase, dir, sizeof(dir));
+    bool update = getenv("UPDATE_REFERENCES") != nullptr;
+    std::vector<FrameSum> sums = loadSums(dir);
+    std::vector<FrameSum> drawn;
+    size_t next = 0;
+    bool identical = true;
+
+    EmulatedIli9341 &display = emulatedDisplay();
+    setup();
+    uint32_t crc = display.checksum();
+    drawn.push_back(FrameSum{0, crc});
+    identical = update || checkFrame(0, dir, sums, next);
+    for (long i = 0; i < iterations && identical; i++) {
+        loop();
+        if (display.checksum() != crc) {
+            crc = display.checksum();
+            drawn.push_back(FrameSum{i + 1, crc});
+            identical = update || checkFrame(i + 1, dir, sums, next);
+        }
+    }
+    if (identical && !update && next < sums.size()) {
+        printf("reference frame %ld was never drawn\n", sums[next].frame);
+        identical = false;
+    }
+    if (update) {
+        char path[300];
+        snprintf(path, sizeof(path), "%s/frames.crc", dir);
+        FILE *file = fopen(path, "w");
+        if (file == nullptr) {
+            printf("cannot write %s\n", path);
+            return 1;
+        }
+        for (const FrameSum &sum : drawn) {
+            fprintf(file, "frame-%04ld.ppm %08x\n", sum.frame, sum.crc);
+        }
+        fclose(file);
+    }
+    return identical ? 0 : 1;
+}
+
+static const RenderCase *currentCase;
+
+static void test_render_case() {
+    fflush(stdout);
+    pid_t child = fork();
+    TEST_ASSERT_TRUE_MESSAGE(child >= 0, "fork failed");
+    if (child == 0) {
+        int status = runCase(*currentCase);
+        fflush(stdout);
+        _exit(status);
+    }
+    int status = 0;
+    TEST_ASSERT_EQUAL(child, waitpid(child, &status, 0));
+    TEST_ASSERT_TRUE_MESSAGE(WIFEXITED(status), "the case crashed");
+    TEST_ASSERT_EQUAL_MESSAGE(0, WEXITSTATUS(status), "frames differ from the references");
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+    UNITY_BEGIN();
+    for (const RenderCase &renderCase : cases) {
+        currentCase = &renderCase;
+        UnityDefaultTestRun(test_render_case, renderCase.name, __LINE__);
+    }
+    return UNITY_END();
+}
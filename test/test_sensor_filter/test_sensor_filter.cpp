@@ -0,0 +1,51 @@
+#include <unity.h>
+#include "SensorFilter.h"
+
+/**
+ * Feeds from, then to until the average has had time to settle, and
+ * checks it landed exactly on to
+ */
+static void checkStep(uint16_t alpha, int32_t from, int32_t to) {
+    SensorFilter filter(5, alpha, 20);
+    for (int i = 0; i < 10; i++) {
+        filter.add(from);
+    }
+    TEST_ASSERT_EQUAL_INT32(from, filter.filtered());
+    for (int i = 0; i < 200; i++) {
+        filter.add(to);
+    }
+    TEST_ASSERT_EQUAL_INT32(to, filter.filtered());
+}
+
+static void test_step_up_converges() {
+    checkStep(77, 0, 1000);
+}
+
+static void test_step_down_converges() {
+    checkStep(77, 1000, 0);
+}
+
+static void test_small_step_converges() {
+    checkStep(77, 0, 1);
+    checkStep(77, 1, 0);
+}
+
+static void test_slowest_alpha_converges() {
+    checkStep(1, 0, 100);
+    checkStep(1, 0, -100);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_step_up_converges);
+    RUN_TEST(test_step_down_converges);
+    RUN_TEST(test_small_step_converges);
+    RUN_TEST(test_slowest_alpha_converges);
+    return UNITY_END();
+}
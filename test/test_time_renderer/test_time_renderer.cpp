@@ -0,0 +1,89 @@
+#include <string.h>
+#include <unity.h>
+#include "native/NativePlatform.h"
+#include "TimeRenderer.h"
+
+static const SegmentLayout layout = {48, 78, 9, 16};
+
+static uint16_t previous[EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight];
+static uint16_t redrawn[EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight];
+
+/**
+ * Counts the pixels that differ between the screen and previous, then
+ * copies the screen into previous
+ */
+static long changedPixels() {
+    const uint16_t *current = emulatedDisplay().pixels();
+    long changed = 0;
+    for (uint32_t i = 0; i < (uint32_t) EmulatedIli9341::panelWidth * EmulatedIli9341::panelHeight; i++) {
+        if (current[i] != previous[i]) {
+            changed++;
+            previous[i] = current[i];
+        }
+    }
+    return changed;
+}
+
+/**
+ * A minute flip at the clock's size has to write exactly the pixels
+ * lastPixelsWritten() reports, at least every pixel that changed, fewer
+ * than drawing the time from scratch, and leave the same image as that;
+ * drawing it again writes nothing
+ */
+static void checkFlip(const char *from, const char *to) {
+    EmulatedIli9341 &display = emulatedDisplay();
+    TimeRenderer renderer(display, layout, 0, layout.height - 1, 0xFFFF, 0x0000, 0x2104);
+    display.fillScreen(0x0000);
+    renderer.draw(to);
+    uint32_t fullPixels = renderer.lastPixelsWritten();
+    memcpy(redrawn, display.pixels(), sizeof(redrawn));
+
+    display.fillScreen(0x0000);
+    renderer.invalidate();
+    renderer.draw(from);
+    changedPixels();
+    uint64_t pushedBefore = display.stats().pixels;
+    renderer.draw(to);
+    uint32_t written = renderer.lastPixelsWritten();
+    uint64_t pushed = display.stats().pixels - pushedBefore;
+    long changed = changedPixels();
+
+    TEST_ASSERT_EQUAL_UINT32(pushed, written);
+    TEST_ASSERT_GREATER_OR_EQUAL(changed, written);
+    TEST_ASSERT_LESS_THAN(fullPixels, written);
+    TEST_ASSERT_EQUAL_MEMORY(redrawn, display.pixels(), sizeof(redrawn));
+    renderer.draw(to);
+    TEST_ASSERT_EQUAL_UINT32(0, renderer.lastPixelsWritten());
+}
+
+static void test_flip_to_hour_ten() {
+    checkFlip("09:59", "10:00");
+}
+
+static void test_flip_to_hour_thirteen() {
+    checkFlip("12:59", "13:00");
+}
+
+static void test_flip_at_midnight() {
+    checkFlip("23:59", "00:00");
+}
+
+static void test_flip_one_minute() {
+    checkFlip("00:00", "00:01");
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+    emulatedDisplay().begin();
+    UNITY_BEGIN();
+    RUN_TEST(test_flip_to_hour_ten);
+    RUN_TEST(test_flip_to_hour_thirteen);
+    RUN_TEST(test_flip_at_midnight);
+    RUN_TEST(test_flip_one_minute);
+    return UNITY_END();
+}
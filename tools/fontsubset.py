@@ -0,0 +1,239 @@
+"""
+Cuts Adafruit GFX font headers in src/Fonts down to the characters a
+source actually draws.
+
+The used set is taken from the sources: a character set declared as
+
+    constexpr char benchCharset[] = "0123456789:"; //font-subset DSEG14Modern_Bold40pt7b rle
+
+adds its characters to the subset of src/Fonts/DSEG14Modern_Bold40pt7b.h,
+which is written to src/Fonts/DSEG14Modern_Bold40pt7bSubset.h with the
+symbols renamed to DSEG14Modern_Bold40pt7bSubset*. The output is still a
+plain GFXfont: the glyph table spans the lowest to the highest used
+character and every unused one in between is an empty glyph without
+bitmap data, so all GFX code keeps working on it.
+
+A font tagged "//font-subset <font> rle" additionally gets
+<font>SubsetRle.h, an RleFont (include/RleFont.h) with the same glyph table
+whose bitmaps are run-length coded: every glyph row is XORed with the row
+above, so the vertical strokes of segment digits mostly vanish, and the
+runs of alternating clear and set pixels are written as nibbles, high
+nibble first. A nibble of 0-14 is the run length, 15 is followed by two
+more nibbles n and the run is 15 + n; longer runs continue after a zero
+length run of the other colour. Each glyph starts on a byte boundary.
+
+The firmware itself draws the time with the segment renderer and the
+date in the full text font, so today only the native runner's font
+benchmark (src/native/main.cpp, -f) uses a subset. The generated headers
+are checked in; run the tool by hand after changing a character set,
+and --check, as run on Travis, only reports stale subsets.
+"""
+
+import io
+import os
+import re
+import sys
+
+SOURCE_EXTENSIONS = ('.cpp', '.h')
+MARKER = re.compile(r'"((?:[^"\\]|\\.)*)"\s*;\s*//font-subset\s+(\w+)(\s+rle)?')
+BITMAPS = re.compile(r'const uint8_t (\w+)Bitmaps\[\] PROGMEM = \{(.*?)\};', re.S)
+GLYPH = re.compile(r'\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}')
+GLYPHS = re.compile(r'GFXglyph (\w+)Glyphs\[\] PROGMEM = \{(.*?)\};', re.S)
+FONT = re.compile(r'const GFXfont (\w+) PROGMEM = \{.*?(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\};', re.S)
+HEADER = re.compile(r'\A\s*(/\*\*.*?\*/)', re.S)
+
+
+def used_characters(source_dir):
+    """Maps font name to the set of characters declared for it, and returns
+    the names of the fonts that also want an RLE version"""
+    used = {}
+    rle = set()
+    for root, _, files in os.walk(source_dir):
+        for name in files:
+            if not name.endswith(SOURCE_EXTENSIONS):
+                continue
+            with io.open(os.path.join(root, name), encoding='utf-8') as source:
+                for match in MARKER.finditer(source.read()):
+                    text = match.group(1).encode().decode('unicode_escape')
+                    used.setdefault(match.group(2), set()).update(text)
+                    if match.group(3):
+                        rle.add(match.group(2))
+    return used, rle
+
+
+def parse_font(path):
+    with io.open(path, encoding='utf-8') as header:
+        text = header.read()
+    bitmaps = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', BITMAPS.search(text).group(2))]
+    glyphs = [tuple(int(v) for v in g) for g in GLYPH.findall(GLYPHS.search(text).group(2))]
+    font = FONT.search(text)
+    comment = HEADER.match(text)
+    return {
+        'bitmaps': bitmaps,
+        'glyphs': glyphs,
+        'first': int(font.group(2), 16),
+        'last': int(font.group(3), 16),
+        'yAdvance': int(font.group(4)),
+        'comment': comment.group(1) if comment else None,
+    }
+
+
+def font_bytes(bitmaps, glyphs):
+    """Flash estimate as printed by fontconvert"""
+    return len(bitmaps) + len(glyphs) * 7 + 7
+
+
+def subset_font(font, characters):
+    codes = sorted(ord(c) for c in characters if font['first'] <= ord(c) <= font['last'])
+    if not codes:
+        raise ValueError('none of the characters are in the font')
+    bitmaps = []
+    glyphs = []
+    for code in range(codes[0], codes[-1] + 1):
+        if code not in codes:
+            glyphs.append((0, 0, 0, 0, 0, 0))
+            continue
+        offset, width, height, advance, x, y = font['glyphs'][code - font['first']]
+        size = (width * height + 7) // 8
+        glyphs.append((len(bitmaps), width, height, advance, x, y))
+        bitmaps.extend(font['bitmaps'][offset:offset + size])
+    return {
+        'bitmaps': bitmaps,
+        'glyphs': glyphs,
+        'first': codes[0],
+        'last': codes[-1],
+        'yAdvance': font['yAdvance'],
+        'comment': font['comment'],
+    }
+
+
+def glyph_bits(font, glyph):
+    offset, width, height = glyph[0], glyph[1], glyph[2]
+    return [(font['bitmaps'][offset + i // 8] >> (7 - i % 8)) & 1 for i in range(width * height)]
+
+
+def rle_runs(bits, width):
+    """Lengths of the alternating clear and set runs of the row deltas"""
+    delta = bits[:width] + [bits[i] ^ bits[i - width] for i in range(width, len(bits))]
+    runs = []
+    colour = 0
+    length = 0
+    for bit in delta:
+        if bit == colour:
+            length += 1
+        else:
+            runs.append(length)
+            colour = bit
+            length = 1
+    runs.append(length)
+    return runs
+
+
+def rle_nibbles(runs):
+    nibbles = []
+    for length in runs:
+        while length >= 15:
+            chunk = min(length - 15, 255)
+            nibbles.extend([15, chunk >> 4, chunk & 15])
+            length -= 15 + chunk
+            if length == 0:
+                break
+            # Zero length run of the other colour, the next one continues this
+            nibbles.append(0)
+        else:
+            nibbles.append(length)
+    return nibbles
+
+
+def rle_font(font):
+    """Same glyph table, bitmap offsets pointing into the run data"""
+    data = []
+    glyphs = []
+    for glyph in font['glyphs']:
+        nibbles = rle_nibbles(rle_runs(glyph_bits(font, glyph), glyph[1])) if glyph[1] * glyph[2] > 0 else []
+        if len(nibbles) % 2:
+            nibbles.append(0)
+        glyphs.append((len(data),) + tuple(glyph[1:]))
+        data.extend((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+    return dict(font, bitmaps=data, glyphs=glyphs)
+
+
+def render_header(name, source_name, font, characters, rle=False):
+    data = name + ('Runs' if rle else 'Bitmaps')
+    out = []
+    if font['comment']:
+        out.append(font['comment'])
+    out.append('')
+    out.append('//Generated by tools/fontsubset.py from %s.h, do not edit.' % source_name)
+    out.append('//Keeps %s' % ''.join(sorted(characters)).replace('\\', '\\\\'))
+    if rle:
+        out.append('//Run-length coded, include RleFont.h first')
+    out.append('')
+    out.append('const uint8_t %s[] PROGMEM = {' % data)
+    rows = [', '.join('0x%02X' % b for b in font['bitmaps'][i:i + 12])
+            for i in range(0, len(font['bitmaps']), 12)]
+    out.append(',\n'.join('  ' + row for row in rows) + ' };')
+    out.append('')
+    out.append('constexpr GFXglyph %sGlyphs[] PROGMEM = {' % name)
+    lines = []
+    for index, glyph in enumerate(font['glyphs']):
+        code = font['first'] + index
+        entry = '  { %5d, %3d, %3d, %3d, %4d, %4d }' % glyph
+        closing = ' }; ' if index == len(font['glyphs']) - 1 else ',   '
+        lines.append("%s%s// 0x%02X '%s'%s" % (entry, closing, code, chr(code),
+                                                  '' if chr(code) in characters else ' (dropped)'))
+    out.extend(lines)
+    out.append('')
+    out.append('const %s %s PROGMEM = {' % ('RleFont' if rle else 'GFXfont', name))
+    out.append('  (uint8_t  *)%s,' % data)
+    out.append('  (GFXglyph *)%sGlyphs,' % name)
+    out.append('  0x%02X, 0x%02X, %d };' % (font['first'], font['last'], font['yAdvance']))
+    out.append('')
+    out.append('// Approx. %d bytes' % font_bytes(font['bitmaps'], font['glyphs']))
+    return '\n'.join(out) + '\n'
+
+
+def write_header(path, text, check, stale):
+    """Only touches the header when it changes, so it does not force a rebuild"""
+    current = None
+    if os.path.exists(path):
+        with io.open(path, encoding='utf-8') as existing:
+            current = existing.read()
+    if current == text:
+        return
+    if check:
+        stale.append(path)
+    else:
+        with io.open(path, 'w', encoding='utf-8') as output:
+            output.write(text)
+
+
+def run(project_dir, check=False):
+    source_dir = os.path.join(project_dir, 'src')
+    font_dir = os.path.join(source_dir, 'Fonts')
+    stale = []
+    used, rle = used_characters(source_dir)
+    for source_name, characters in sorted(used.items()):
+        font = parse_font(os.path.join(font_dir, source_name + '.h'))
+        subset = subset_font(font, characters)
+        name = source_name + 'Subset'
+        write_header(os.path.join(font_dir, name + '.h'), render_header(name, source_name, subset, characters),
+                     check, stale)
+        print('fontsubset: %s %d -> %d bytes (%d of %d glyphs)' % (
+            source_name, font_bytes(font['bitmaps'], font['glyphs']),
+            font_bytes(subset['bitmaps'], subset['glyphs']),
+            len(characters), len(font['glyphs'])))
+        if source_name in rle:
+            coded = rle_font(subset)
+            write_header(os.path.join(font_dir, name + 'Rle.h'),
+                         render_header(name + 'Rle', source_name, coded, characters, True), check, stale)
+            print('fontsubset: %s run-length coded bitmaps %d -> %d bytes (%.2fx)' % (
+                name, len(subset['bitmaps']), len(coded['bitmaps']),
+                float(len(subset['bitmaps'])) / max(len(coded['bitmaps']), 1)))
+    for path in stale:
+        print('fontsubset: %s is out of date' % path)
+    return not stale
+
+
+if __name__ == '__main__':
+    sys.exit(0 if run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), '--check' in sys.argv[1:]) else 1)